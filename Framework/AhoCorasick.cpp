@@ -0,0 +1,341 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AhoCorasick.hpp"
+#include "Simd.hpp"
+#include "String.hpp"
+#include <cstring>
+
+//! maximum number of symbols for a dense transition table
+static const int sDenseSymbolCount = 64;
+//! maximum number of entries of a dense transition table, 4 MB of transitions
+static const int sDenseTableSize = 1 << 20;
+
+namespace Lupus {
+	namespace System {
+		static int FindEdge(const int* firstEdge, const int* nextEdge, const int* edgeSymbols, int state, int symbol)
+		{
+			for (int edge = firstEdge[state]; edge != -1; edge = nextEdge[edge]) {
+				if (edgeSymbols[edge] == symbol) {
+					return edge;
+				}
+			}
+
+			return -1;
+		}
+
+		bool PatternMatch::operator==(const PatternMatch& match) const
+		{
+			return (Index == match.Index && Pattern == match.Pattern && Length == match.Length);
+		}
+
+		AhoCorasick::AhoCorasick(const Vector<String>& patterns, CaseSensitivity sensitivity) :
+			_symbolCount(1),
+			_stateCount(1),
+			_table(nullptr),
+			_edgeOffsets(nullptr),
+			_edgeSymbols(nullptr),
+			_edgeTargets(nullptr),
+			_failure(nullptr),
+			_patterns(nullptr),
+			_outputs(nullptr),
+			_lengths(nullptr),
+			_patternCount(patterns.Count()),
+			_maxLength(0),
+			_sensitivity(sensitivity)
+		{
+			// variables
+			bool insensitive = (sensitivity == CaseSensitivity::CaseInsensitive);
+			int maxStates = 1;
+
+			// assign a symbol to every char used by a pattern
+			memset(_symbols, 0, sizeof(_symbols));
+			_lengths = new int[_patternCount];
+
+			for (int i = 0; i < _patternCount; i++) {
+				const char* data = patterns[i].Data;
+				int length = patterns[i].Length;
+
+				for (int j = 0; j < length; j++) {
+					int key = static_cast<unsigned char>(data[j]);
+
+					if (insensitive) {
+						key = AsciiLowerTable[key];
+					}
+
+					if (!_symbols[key]) {
+						_symbols[key] = _symbolCount++;
+					}
+				}
+
+				_lengths[i] = length;
+				maxStates += length;
+				_maxLength = (length > _maxLength) ? length : _maxLength;
+			}
+
+			// other case shares the symbol
+			if (insensitive) {
+				for (int i = 0; i < 256; i++) {
+					_symbols[i] = _symbols[AsciiLowerTable[i]];
+				}
+			}
+
+			// variables, edge e always leads to state e + 1
+			int* firstEdge = new int[maxStates];
+			int* nextEdge = new int[maxStates];
+			int* edgeSymbols = new int[maxStates];
+
+			_patterns = new int[maxStates];
+
+			for (int i = 0; i < maxStates; i++) {
+				firstEdge[i] = -1;
+				_patterns[i] = -1;
+			}
+
+			// create trie
+			for (int i = 0; i < _patternCount; i++) {
+				const char* data = patterns[i].Data;
+				int length = _lengths[i];
+				int state = 0;
+
+				for (int j = 0; j < length; j++) {
+					int symbol = _symbols[static_cast<unsigned char>(data[j])];
+					int edge = FindEdge(firstEdge, nextEdge, edgeSymbols, state, symbol);
+
+					if (edge == -1) {
+						edge = _stateCount - 1;
+						edgeSymbols[edge] = symbol;
+						nextEdge[edge] = firstEdge[state];
+						firstEdge[state] = edge;
+						_stateCount++;
+					}
+
+					state = edge + 1;
+				}
+
+				if (length > 0 && _patterns[state] == -1) {
+					_patterns[state] = i;
+				}
+			}
+
+			Link(firstEdge, nextEdge, edgeSymbols);
+
+			delete[] firstEdge;
+			delete[] nextEdge;
+			delete[] edgeSymbols;
+		}
+
+		AhoCorasick::~AhoCorasick()
+		{
+			delete[] _table;
+			delete[] _edgeOffsets;
+			delete[] _edgeSymbols;
+			delete[] _edgeTargets;
+			delete[] _failure;
+			delete[] _patterns;
+			delete[] _outputs;
+			delete[] _lengths;
+		}
+
+		PatternMatch AhoCorasick::Find(const char* text, int textLength) const
+		{
+			return FindLeftmost(text, textLength, false);
+		}
+
+		PatternMatch AhoCorasick::FindLongest(const char* text, int textLength) const
+		{
+			return FindLeftmost(text, textLength, true);
+		}
+
+		PatternMatch AhoCorasick::FindLeftmost(const char* text, int textLength, bool longest) const
+		{
+			// variables
+			PatternMatch result = { -1, -1, 0 };
+			int state = 0;
+
+			for (int i = 0; i < textLength; i++) {
+				// no later match can start before the current one or be longer at its position
+				if (result.Index != -1 && (i - _maxLength + 1) > result.Index) {
+					break;
+				}
+
+				state = Next(state, _symbols[static_cast<unsigned char>(text[i])]);
+
+				// check every pattern ending here
+				for (int output = (_patterns[state] != -1) ? state : _outputs[state]; output != -1; output = _outputs[output]) {
+					int pattern = _patterns[output];
+					int index = i - _lengths[pattern] + 1;
+					bool preferred = longest ? (_lengths[pattern] > result.Length) : (pattern < result.Pattern);
+
+					if (result.Index == -1 || index < result.Index || (index == result.Index && preferred)) {
+						result.Index = index;
+						result.Pattern = pattern;
+						result.Length = _lengths[pattern];
+					}
+				}
+			}
+
+			return result;
+		}
+
+		Vector<PatternMatch> AhoCorasick::FindAll(const char* text, int textLength) const
+		{
+			// variables
+			int count = 0;
+			int state = 0;
+
+			// count matches first, so the result is allocated once
+			for (int i = 0; i < textLength; i++) {
+				state = Next(state, _symbols[static_cast<unsigned char>(text[i])]);
+
+				for (int output = (_patterns[state] != -1) ? state : _outputs[state]; output != -1; output = _outputs[output]) {
+					count++;
+				}
+			}
+
+			if (!count) {
+				return Vector<PatternMatch>();
+			}
+
+			// collect every pattern ending at each position
+			Vector<PatternMatch> result(count);
+			int index = 0;
+			state = 0;
+
+			for (int i = 0; i < textLength; i++) {
+				state = Next(state, _symbols[static_cast<unsigned char>(text[i])]);
+
+				for (int output = (_patterns[state] != -1) ? state : _outputs[state]; output != -1; output = _outputs[output]) {
+					int pattern = _patterns[output];
+					PatternMatch match = { i - _lengths[pattern] + 1, pattern, _lengths[pattern] };
+
+					result[index++] = match;
+				}
+			}
+
+			return result;
+		}
+
+		int AhoCorasick::Next(int state, int symbol) const
+		{
+			if (_table) {
+				return _table[state * _symbolCount + symbol];
+			} else if (symbol == 0) {
+				// char isn't used by any pattern
+				return 0;
+			}
+
+			// follow failure links until a matching edge exists
+			for (;;) {
+				for (int i = _edgeOffsets[state]; i < _edgeOffsets[state + 1]; i++) {
+					if (_edgeSymbols[i] == symbol) {
+						return _edgeTargets[i];
+					}
+				}
+
+				if (state == 0) {
+					return 0;
+				}
+
+				state = _failure[state];
+			}
+		}
+
+		void AhoCorasick::Link(const int* firstEdge, const int* nextEdge, const int* edgeSymbols)
+		{
+			// variables
+			int* queue = new int[_stateCount];
+			int head = 0;
+			int tail = 0;
+
+			_failure = new int[_stateCount];
+			_outputs = new int[_stateCount];
+			_failure[0] = 0;
+			_outputs[0] = -1;
+			queue[tail++] = 0;
+
+			// breadth first, so failure links always point to finished states
+			while (head < tail) {
+				int state = queue[head++];
+
+				for (int edge = firstEdge[state]; edge != -1; edge = nextEdge[edge]) {
+					int target = edge + 1;
+					int failure = 0;
+
+					if (state != 0) {
+						for (int current = _failure[state]; ; current = _failure[current]) {
+							int next = FindEdge(firstEdge, nextEdge, edgeSymbols, current, edgeSymbols[edge]);
+
+							if (next != -1) {
+								failure = next + 1;
+								break;
+							} else if (current == 0) {
+								break;
+							}
+						}
+					}
+
+					_failure[target] = failure;
+					_outputs[target] = (_patterns[failure] != -1) ? failure : _outputs[failure];
+					queue[tail++] = target;
+				}
+			}
+
+			if (_symbolCount <= sDenseSymbolCount && _stateCount <= (sDenseTableSize / _symbolCount)) {
+				// dense table, missing transitions are taken from the failure state
+				_table = new int[_stateCount * _symbolCount];
+
+				for (int i = 0; i < _stateCount; i++) {
+					int state = queue[i];
+					int* row = _table + state * _symbolCount;
+
+					if (state == 0) {
+						memset(row, 0, _symbolCount * sizeof(int));
+					} else {
+						memcpy(row, _table + _failure[state] * _symbolCount, _symbolCount * sizeof(int));
+					}
+
+					for (int edge = firstEdge[state]; edge != -1; edge = nextEdge[edge]) {
+						row[edgeSymbols[edge]] = edge + 1;
+					}
+				}
+			} else {
+				// compressed edge lists
+				int count = 0;
+
+				_edgeOffsets = new int[_stateCount + 1];
+				_edgeSymbols = new int[_stateCount];
+				_edgeTargets = new int[_stateCount];
+
+				for (int state = 0; state < _stateCount; state++) {
+					_edgeOffsets[state] = count;
+
+					for (int edge = firstEdge[state]; edge != -1; edge = nextEdge[edge]) {
+						_edgeSymbols[count] = edgeSymbols[edge];
+						_edgeTargets[count] = edge + 1;
+						count++;
+					}
+				}
+
+				_edgeOffsets[_stateCount] = count;
+			}
+
+			delete[] queue;
+		}
+	}
+}
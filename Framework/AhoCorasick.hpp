@@ -0,0 +1,137 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_AHOCORASICK_HPP
+#define LUPUS_AHOCORASICK_HPP
+
+#include "Types.hpp"
+#include "Vector.hpp"
+
+namespace Lupus {
+	namespace System {
+		// declarations
+		class String;
+
+		//! position of a pattern found by a multi pattern search
+		struct LUPUS_API PatternMatch
+		{
+			//! index of first matching char within the text
+			int Index;
+			//! index of the pattern within the pattern list
+			int Pattern;
+			//! length of the pattern
+			int Length;
+			//! compare two matches
+			bool operator==(const PatternMatch& match) const;
+		};
+
+		/**
+		 * aho-corasick automaton for searching many patterns within a single pass
+		 *
+		 * built once from a pattern list and reusable for any number of texts. small alphabets use a
+		 * dense transition table, large ones use compressed edge lists with failure links.
+		 * empty patterns never match, duplicate patterns report the first one.
+		 */
+		class LUPUS_API AhoCorasick : public Object
+		{
+			//! symbol of every byte, 0 for bytes not used by any pattern
+			int _symbols[256];
+			//! number of symbols including the unused symbol 0
+			int _symbolCount;
+			//! number of states, state 0 is the root
+			int _stateCount;
+			//! dense transitions with _symbolCount entries per state, nullptr if compressed
+			int* _table;
+			//! compressed transitions, first edge of every state and end of last state
+			int* _edgeOffsets;
+			//! compressed transitions, symbol of every edge
+			int* _edgeSymbols;
+			//! compressed transitions, target state of every edge
+			int* _edgeTargets;
+			//! failure link of every state
+			int* _failure;
+			//! pattern ending at every state or -1
+			int* _patterns;
+			//! next state with a pattern on the failure chain or -1
+			int* _outputs;
+			//! length of every pattern
+			int* _lengths;
+			//! number of patterns
+			int _patternCount;
+			//! length of longest pattern
+			int _maxLength;
+			//! case sensitivity of all patterns
+			CaseSensitivity _sensitivity;
+		public:
+			//! Return number of patterns
+			PropertyReader<int> Count = PropertyReader<int>(_patternCount);
+			//! Return case sensitivity of all patterns
+			PropertyReader<CaseSensitivity> Sensitivity = PropertyReader<CaseSensitivity>(_sensitivity);
+			/**
+			 * Build automaton from given patterns
+			 *
+			 * @param patterns patterns to search for
+			 * @param sensitivity search case sensitive or case insensitive
+			 */
+			AhoCorasick(const Vector<String>& patterns, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+			AhoCorasick(const AhoCorasick&) = delete;
+			AhoCorasick(AhoCorasick&&) = delete;
+			//! Destructor
+			virtual ~AhoCorasick();
+			/**
+			 * Search for the leftmost match of any pattern
+			 *
+			 * on equal positions the earlier pattern wins
+			 *
+			 * @param text native search string
+			 * @param textLength length of search string without the null char
+			 * @return leftmost match, its index is -1 if no pattern was found
+			 */
+			PatternMatch Find(const char* text, int textLength) const;
+			/**
+			 * Search for the leftmost match of any pattern, preferring the longest one
+			 *
+			 * on equal positions the longest pattern wins
+			 *
+			 * @param text native search string
+			 * @param textLength length of search string without the null char
+			 * @return leftmost longest match, its index is -1 if no pattern was found
+			 */
+			PatternMatch FindLongest(const char* text, int textLength) const;
+			/**
+			 * Search for all matches of all patterns including overlapping ones
+			 *
+			 * @param text native search string
+			 * @param textLength length of search string without the null char
+			 * @return all matches ordered by their end
+			 */
+			Vector<PatternMatch> FindAll(const char* text, int textLength) const;
+			AhoCorasick& operator=(const AhoCorasick&) = delete;
+			AhoCorasick& operator=(AhoCorasick&&) = delete;
+		private:
+			//! leftmost match, on equal positions the longest or the earliest pattern
+			PatternMatch FindLeftmost(const char* text, int textLength, bool longest) const;
+			//! follow transition of a state
+			int Next(int state, int symbol) const;
+			//! create transitions, failure links and outputs from the trie
+			void Link(const int* firstEdge, const int* nextEdge, const int* edgeSymbols);
+		};
+	}
+}
+
+#endif
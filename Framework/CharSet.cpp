@@ -0,0 +1,95 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharSet.hpp"
+#include "Simd.hpp"
+
+namespace Lupus {
+	namespace System {
+		CharSet::CharSet(const ISequence<char>& sequence) :
+			CharSet()
+		{
+			foreach(item, sequence) {
+				Add(item->CurrentItem());
+			}
+		}
+
+		CharSet& CharSet::Add(char ch)
+		{
+			_bits[static_cast<ubyte>(ch) >> 6] |= (1ULL << (static_cast<ubyte>(ch) & 63));
+			return (*this);
+		}
+
+		CharSet& CharSet::Remove(char ch)
+		{
+			_bits[static_cast<ubyte>(ch) >> 6] &= ~(1ULL << (static_cast<ubyte>(ch) & 63));
+			return (*this);
+		}
+
+		int CharSet::Count() const
+		{
+			// variables
+			int result = 0;
+
+			// count set bits
+			for (int i = 0; i < 4; i++) {
+				for (ullong bits = _bits[i]; bits; bits &= bits - 1) {
+					result++;
+				}
+			}
+
+			return result;
+		}
+
+		bool CharSet::IsEmpty() const
+		{
+			return !(_bits[0] | _bits[1] | _bits[2] | _bits[3]);
+		}
+
+		bool CharSet::IsAscii() const
+		{
+			return !(_bits[2] | _bits[3]);
+		}
+
+		CharSet CharSet::FoldCase() const
+		{
+			// variables
+			CharSet result(*this);
+
+			// add other case of every ascii letter
+			for (int i = 0; i < 256; i++) {
+				if (Contains(static_cast<char>(i))) {
+					result.Add(static_cast<char>(AsciiLowerTable[i]));
+					result.Add(static_cast<char>(AsciiUpperTable[i]));
+				}
+			}
+
+			return result;
+		}
+
+		bool CharSet::operator==(const CharSet& set) const
+		{
+			return (_bits[0] == set._bits[0] && _bits[1] == set._bits[1] && _bits[2] == set._bits[2] && _bits[3] == set._bits[3]);
+		}
+
+		bool CharSet::operator!=(const CharSet& set) const
+		{
+			return !operator==(set);
+		}
+	}
+}
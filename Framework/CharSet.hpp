@@ -0,0 +1,86 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_CHARSET_HPP
+#define LUPUS_CHARSET_HPP
+
+#include "Types.hpp"
+#include "ISequence.hpp"
+
+namespace Lupus {
+	namespace System {
+		/**
+		 * set of chars stored as 256 bit bitmap
+		 *
+		 * checking a char is a single bit test, independent of the set size. sets created
+		 * from string literals are built at compile time where constexpr is supported.
+		 */
+		class LUPUS_API CharSet
+		{
+			//! one bit for every char value
+			ullong _bits[4];
+		public:
+			//! Create an empty set
+			LUPUS_CONSTEXPR CharSet();
+			/**
+			 * Create a set from all chars of a native string
+			 *
+			 * intended for short literals like " \t,;", nullptr creates an empty set
+			 *
+			 * @param chars null terminated native string
+			 */
+			explicit LUPUS_CONSTEXPR CharSet(const char* chars);
+			/**
+			 * Create a set from all chars of a sequence
+			 *
+			 * @param sequence chars to add
+			 */
+			CharSet(const ISequence<char>& sequence);
+			/**
+			 * Check if given char is part of this set
+			 *
+			 * @param ch char to check
+			 * @return true if ch is part of this set
+			 */
+			LUPUS_CONSTEXPR bool Contains(char ch) const;
+			//! Add a char to this set
+			CharSet& Add(char ch);
+			//! Remove a char from this set
+			CharSet& Remove(char ch);
+			//! Return number of chars within this set
+			int Count() const;
+			//! Check if this set is empty
+			bool IsEmpty() const;
+			//! Check if this set contains only chars below 128
+			bool IsAscii() const;
+			//! Return a copy containing the ascii lower and upper case variant of every char
+			CharSet FoldCase() const;
+			//! Compare two sets
+			bool operator==(const CharSet& set) const;
+			//! Compare two sets
+			bool operator!=(const CharSet& set) const;
+		private:
+			//! compute one word of the bitmap from a native string
+			static LUPUS_CONSTEXPR ullong Word(const char* chars, int index);
+		};
+	}
+}
+
+#include "CharSet.inl"
+
+#endif
@@ -0,0 +1,56 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+namespace Lupus {
+	namespace System {
+#ifdef LUPUS_HAS_CONSTEXPR
+		constexpr CharSet::CharSet() :
+			_bits{ 0, 0, 0, 0 }
+		{
+		}
+
+		constexpr CharSet::CharSet(const char* chars) :
+			_bits{ Word(chars, 0), Word(chars, 1), Word(chars, 2), Word(chars, 3) }
+		{
+		}
+#else
+		inline CharSet::CharSet()
+		{
+			_bits[0] = _bits[1] = _bits[2] = _bits[3] = 0;
+		}
+
+		inline CharSet::CharSet(const char* chars)
+		{
+			for (int i = 0; i < 4; i++) {
+				_bits[i] = Word(chars, i);
+			}
+		}
+#endif
+
+		inline LUPUS_CONSTEXPR bool CharSet::Contains(char ch) const
+		{
+			return (((_bits[static_cast<ubyte>(ch) >> 6] >> (static_cast<ubyte>(ch) & 63)) & 1) != 0);
+		}
+
+		inline LUPUS_CONSTEXPR ullong CharSet::Word(const char* chars, int index)
+		{
+			return ((!chars || !*chars) ? 0 :
+				((((static_cast<ubyte>(*chars) >> 6) == index) ? (1ULL << (static_cast<ubyte>(*chars) & 63)) : 0) | Word(chars + 1, index)));
+		}
+	}
+}
@@ -0,0 +1,239 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Encoding.hpp"
+#include "Simd.hpp"
+#include "String.hpp"
+#include "Integer.hpp"
+#include "Exception.hpp"
+#include <cstring>
+
+static void CheckArguments(const void* source, int sourceLength)
+{
+	if (!source && sourceLength) {
+		throw Lupus::ArgumentNullException("source must have a valid value");
+	} else if (sourceLength < 0) {
+		throw Lupus::ArgumentOutOfRangeException("sourceLength must be greater than or equal to zero");
+	}
+}
+
+static void ThrowInvalid(const char* encoding, int index)
+{
+	throw Lupus::EncodingException(Lupus::System::String("invalid ") + encoding + " sequence at index " + Lupus::System::Integer::ToString(index));
+}
+
+template <typename T>
+static int DecodeUtf8(const unsigned char* text, int textLength, T* target, bool surrogates)
+{
+	// variables
+	int i = 0;
+	int result = 0;
+
+	while (i < textLength) {
+		// widen ascii eight chars at a time
+		if (i + 8 <= textLength) {
+			unsigned long long word;
+			memcpy(&word, text + i, 8);
+
+			if (!(word & 0x8080808080808080ULL)) {
+				if (target) {
+					for (int j = 0; j < 8; j++) {
+						target[result + j] = static_cast<T>(text[i + j]);
+					}
+				}
+
+				i += 8;
+				result += 8;
+				continue;
+			}
+		}
+
+		// decode a single sequence, the text is validated already
+		Lupus::uint code = text[i];
+
+		if (code < 0x80) {
+			i += 1;
+		} else if (code < 0xe0) {
+			code = ((code & 0x1f) << 6) | (text[i + 1] & 0x3f);
+			i += 2;
+		} else if (code < 0xf0) {
+			code = ((code & 0x0f) << 12) | ((text[i + 1] & 0x3f) << 6) | (text[i + 2] & 0x3f);
+			i += 3;
+		} else {
+			code = ((code & 0x07) << 18) | ((text[i + 1] & 0x3f) << 12) | ((text[i + 2] & 0x3f) << 6) | (text[i + 3] & 0x3f);
+			i += 4;
+		}
+
+		// code points beyond the basic plane need a surrogate pair in utf-16
+		if (surrogates && code >= 0x10000) {
+			if (target) {
+				target[result] = static_cast<T>(0xd800 + ((code - 0x10000) >> 10));
+				target[result + 1] = static_cast<T>(0xdc00 + ((code - 0x10000) & 0x3ff));
+			}
+
+			result += 2;
+		} else {
+			if (target) {
+				target[result] = static_cast<T>(code);
+			}
+
+			result += 1;
+		}
+	}
+
+	return result;
+}
+
+static int EncodeUtf8(Lupus::uint code, char* target)
+{
+	// compute result
+	if (code < 0x80) {
+		if (target) {
+			target[0] = static_cast<char>(code);
+		}
+
+		return 1;
+	} else if (code < 0x800) {
+		if (target) {
+			target[0] = static_cast<char>(0xc0 | (code >> 6));
+			target[1] = static_cast<char>(0x80 | (code & 0x3f));
+		}
+
+		return 2;
+	} else if (code < 0x10000) {
+		if (target) {
+			target[0] = static_cast<char>(0xe0 | (code >> 12));
+			target[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+			target[2] = static_cast<char>(0x80 | (code & 0x3f));
+		}
+
+		return 3;
+	}
+
+	if (target) {
+		target[0] = static_cast<char>(0xf0 | (code >> 18));
+		target[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+		target[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+		target[3] = static_cast<char>(0x80 | (code & 0x3f));
+	}
+
+	return 4;
+}
+
+namespace Lupus {
+	namespace System {
+		int Utf8ToUtf16(const char* source, int sourceLength, ushort* target)
+		{
+			// check arguments
+			CheckArguments(source, sourceLength);
+
+			// variables
+			int invalid = FindInvalidUtf8(source, sourceLength);
+
+			if (invalid >= 0) {
+				ThrowInvalid("utf-8", invalid);
+			}
+
+			return DecodeUtf8(reinterpret_cast<const unsigned char*>(source), sourceLength, target, true);
+		}
+
+		int Utf16ToUtf8(const ushort* source, int sourceLength, char* target)
+		{
+			// check arguments
+			CheckArguments(source, sourceLength);
+
+			// variables
+			int i = 0;
+			int result = 0;
+
+			while (i < sourceLength) {
+				// narrow ascii four code units at a time
+				if (i + 4 <= sourceLength) {
+					unsigned long long word;
+					memcpy(&word, source + i, 8);
+
+					if (!(word & 0xff80ff80ff80ff80ULL)) {
+						if (target) {
+							for (int j = 0; j < 4; j++) {
+								target[result + j] = static_cast<char>(source[i + j]);
+							}
+						}
+
+						i += 4;
+						result += 4;
+						continue;
+					}
+				}
+
+				// combine surrogate pairs
+				uint code = source[i];
+
+				if (code >= 0xd800 && code <= 0xdfff) {
+					if (code > 0xdbff || i + 1 >= sourceLength || source[i + 1] < 0xdc00 || source[i + 1] > 0xdfff) {
+						ThrowInvalid("utf-16", i);
+					}
+
+					code = 0x10000 + ((code - 0xd800) << 10) + (source[i + 1] - 0xdc00);
+					i += 2;
+				} else {
+					i += 1;
+				}
+
+				result += EncodeUtf8(code, target ? target + result : nullptr);
+			}
+
+			return result;
+		}
+
+		int Utf8ToUtf32(const char* source, int sourceLength, uint* target)
+		{
+			// check arguments
+			CheckArguments(source, sourceLength);
+
+			// variables
+			int invalid = FindInvalidUtf8(source, sourceLength);
+
+			if (invalid >= 0) {
+				ThrowInvalid("utf-8", invalid);
+			}
+
+			return DecodeUtf8(reinterpret_cast<const unsigned char*>(source), sourceLength, target, false);
+		}
+
+		int Utf32ToUtf8(const uint* source, int sourceLength, char* target)
+		{
+			// check arguments
+			CheckArguments(source, sourceLength);
+
+			// variables
+			int result = 0;
+
+			for (int i = 0; i < sourceLength; i++) {
+				uint code = source[i];
+
+				if (code > 0x10ffff || (code >= 0xd800 && code <= 0xdfff)) {
+					ThrowInvalid("utf-32", i);
+				}
+
+				result += EncodeUtf8(code, target ? target + result : nullptr);
+			}
+
+			return result;
+		}
+	}
+}
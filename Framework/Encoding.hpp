@@ -0,0 +1,97 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_ENCODING_HPP
+#define LUPUS_ENCODING_HPP
+
+#include "Types.hpp"
+
+namespace Lupus {
+	namespace System {
+		/**
+		 * converts utf-8 to utf-16
+		 *
+		 * the source is validated with FindInvalidUtf8 first and decoded without further checks
+		 * afterwards. runs of ascii are widened eight chars at a time.
+		 *
+		 * \b Exceptions
+		 * - ArgumentNullException
+		 * - ArgumentOutOfRangeException
+		 * - EncodingException
+		 *
+		 * @param source utf-8 chars to convert
+		 * @param sourceLength number of chars
+		 * @param target receives the code units, nullptr to compute their number only
+		 * @return number of utf-16 code units, at most sourceLength
+		 */
+		LUPUS_API int Utf8ToUtf16(const char* source, int sourceLength, ushort* target);
+
+		/**
+		 * converts utf-16 to utf-8
+		 *
+		 * runs of ascii are narrowed four code units at a time. unpaired surrogates are rejected.
+		 *
+		 * \b Exceptions
+		 * - ArgumentNullException
+		 * - ArgumentOutOfRangeException
+		 * - EncodingException
+		 *
+		 * @param source utf-16 code units to convert
+		 * @param sourceLength number of code units
+		 * @param target receives the chars, nullptr to compute their number only
+		 * @return number of utf-8 chars, at most three times sourceLength
+		 */
+		LUPUS_API int Utf16ToUtf8(const ushort* source, int sourceLength, char* target);
+
+		/**
+		 * converts utf-8 to utf-32
+		 *
+		 * \sa Utf8ToUtf16
+		 *
+		 * \b Exceptions
+		 * - ArgumentNullException
+		 * - ArgumentOutOfRangeException
+		 * - EncodingException
+		 *
+		 * @param source utf-8 chars to convert
+		 * @param sourceLength number of chars
+		 * @param target receives the code points, nullptr to compute their number only
+		 * @return number of code points, at most sourceLength
+		 */
+		LUPUS_API int Utf8ToUtf32(const char* source, int sourceLength, uint* target);
+
+		/**
+		 * converts utf-32 to utf-8
+		 *
+		 * surrogates and code points above 0x10ffff are rejected.
+		 *
+		 * \b Exceptions
+		 * - ArgumentNullException
+		 * - ArgumentOutOfRangeException
+		 * - EncodingException
+		 *
+		 * @param source code points to convert
+		 * @param sourceLength number of code points
+		 * @param target receives the chars, nullptr to compute their number only
+		 * @return number of utf-8 chars, at most four times sourceLength
+		 */
+		LUPUS_API int Utf32ToUtf8(const uint* source, int sourceLength, char* target);
+	}
+}
+
+#endif
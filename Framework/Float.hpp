@@ -20,29 +20,46 @@
 #define LUPUS_FLOAT_HPP
 
 #include "Types.hpp"
+#include "StringView.hpp"
 
 namespace Lupus {
 	namespace System {
 		class String;
+		template <typename T> class Vector;
+
+		//! notation for floating-point conversions
+		enum class FloatFormat {
+			General,
+			Fixed,
+			Scientific
+		};
 
 		//! provides conversion routines for floating-point numbers
 		class LUPUS_API Float
 		{
 		public:
+			//! buffer size required by FormatTo, including the terminating null
+			static const int MaxFormatLength = 411;
+
+			//! \sa Float::ToString(double, FloatFormat, int)
+			static String ToString(float value, FloatFormat format = FloatFormat::General, int precision = -1);
 			/**
-			 * convert a single precision floating-point numbers to a string
+			 * convert a double precision floating-point number to a string
 			 *
-			 * @param f floating-point number
-			 * @return conversion result as a string
-			 */
-			static String ToString(float f);
-			/**
-			 * convert a double precision floating-point numbers to a string
+			 * without precision the digits are round-trip-safe, they parse
+			 * back to the same value and are usually, but not always, the
+			 * shortest such digits. with a precision the exact binary value
+			 * is rounded half to even, like printf does. it counts significant
+			 * digits for general and digits after the point for fixed and
+			 * scientific notation. general notation chooses between fixed and
+			 * scientific like printf does.
 			 *
-			 * @param d double precision floating-point number
+			 * @param value floating-point number
+			 * @param format general, fixed or scientific notation
+			 * @param precision -1 for round trip digits, otherwise 0 to 99
 			 * @return conversion result as a string
 			 */
-			static String ToString(double d);
+			static String ToString(double value, FloatFormat format = FloatFormat::General, int precision = -1);
 			/**
 			 * convert a 128-bit floating-point numbers to a string
 			 *
@@ -50,30 +67,82 @@ namespace Lupus {
 			 * @return conversion result as a string
 			 */
 			static String ToString(real r);
+			//! \sa Float::FormatTo(char*, double, FloatFormat, int)
+			static int FormatTo(char* buffer, float value, FloatFormat format = FloatFormat::General, int precision = -1);
 			/**
-			 * convert a string to a single precision floating-point number
+			 * write a floating-point number into caller provided storage
 			 *
-			 * @param string string for conversion
-			 * @param result output argument for conversion
-			 * @return true if successful, otherwise false
+			 * uses the same format as ToString, but neither allocates nor calls the c runtime.
+			 *
+			 * @param buffer storage for at least MaxFormatLength chars
+			 * @param value floating-point number
+			 * @param format general, fixed or scientific notation
+			 * @param precision -1 for round trip digits, otherwise 0 to 99
+			 * @return number of chars written, excluding the terminating null
 			 */
-			static bool TryParse(const String& string, float& result);
+			static int FormatTo(char* buffer, double value, FloatFormat format = FloatFormat::General, int precision = -1);
+			//! \sa Float::AppendTo(String&, double, FloatFormat, int)
+			static String& AppendTo(String& string, float value, FloatFormat format = FloatFormat::General, int precision = -1);
+			/**
+			 * append a floating-point number to a string without a temporary string
+			 *
+			 * @param string target string
+			 * @param value floating-point number
+			 * @param format general, fixed or scientific notation
+			 * @param precision -1 for round trip digits, otherwise 0 to 99
+			 * @return reference to string
+			 */
+			static String& AppendTo(String& string, double value, FloatFormat format = FloatFormat::General, int precision = -1);
+			//! \sa Float::TryParse(const StringView&, double&)
+			static bool TryParse(const StringView& string, float& result);
 			/**
 			 * convert a string to a double precision floating-point number
 			 *
+			 * accepts an optional sign, digits with an optional point and an optional
+			 * exponent, as well as inf, infinity and nan in any case. the whole string
+			 * has to be a number. the result is correctly rounded and independent of
+			 * the locale.
+			 *
 			 * @param string string for conversion
 			 * @param result output argument for conversion
 			 * @return true if successful, otherwise false
 			 */
-			static bool TryParse(const String& string, double& result);
+			static bool TryParse(const StringView& string, double& result);
+			//! \sa Float::TryParse(const StringView&, double&)
+			static bool TryParse(const StringView& string, real& result);
+			//! \sa Float::TryParse(const StringView&, double&, int&)
+			static bool TryParse(const StringView& string, float& result, int& consumed);
 			/**
-			 * convert a string to a 128-bit floating-point numbers
+			 * convert the number at the beginning of a string
 			 *
-			 * @param string string for conversion
-			 * @param result output argument for conversion
+			 * parses as many chars as form a number and ignores the rest, so numbers can be read
+			 * from within larger buffers.
+			 *
+			 * @param string string starting with a number
+			 * @param result output argument where the conversion result is written to
+			 * @param consumed output argument receiving the number of parsed chars, zero on failure
 			 * @return true if successful, otherwise false
 			 */
-			static bool TryParse(const String& string, real& result);
+			static bool TryParse(const StringView& string, double& result, int& consumed);
+			//! \sa Float::TryParse(const StringView&, double&, int&)
+			static bool TryParse(const StringView& string, real& result, int& consumed);
+			//! \sa Float::ParseColumn(const StringView&, char, Vector<double>&, Vector<int>&)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<float>& values, Vector<int>& errors);
+			/**
+			 * convert every field of a delimited line and append the results
+			 *
+			 * fields are found by vectorized delimiter scans and parsed in place, without
+			 * a temporary string per field. the vector grows once per call. every field
+			 * gets an entry, invalid fields get zero and their index into values is
+			 * appended to errors, so a whole column can be checked at once.
+			 *
+			 * @param text delimited numbers, an empty text has no fields
+			 * @param delimiter char between two fields
+			 * @param values vector the converted fields are appended to
+			 * @param errors vector the indices of invalid fields are appended to
+			 * @return true if every field is a number, otherwise false
+			 */
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<double>& values, Vector<int>& errors);
 		};
 	}
 }
@@ -0,0 +1,154 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Hash.hpp"
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#  include <intrin.h>
+#endif
+
+//! mixing constants
+static const Lupus::ullong sSecret[4] = {
+	0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+};
+
+//! every byte set to one
+static const Lupus::ullong sOnes = 0x0101010101010101ULL;
+
+static void Multiply(Lupus::ullong& lhs, Lupus::ullong& rhs)
+{
+	// full 128 bit product, low half into lhs and high half into rhs
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+	lhs = static_cast<Lupus::ullong>(product);
+	rhs = static_cast<Lupus::ullong>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	lhs = _umul128(lhs, rhs, &rhs);
+#else
+	Lupus::ullong lhsHigh = lhs >> 32, lhsLow = lhs & 0xffffffffULL;
+	Lupus::ullong rhsHigh = rhs >> 32, rhsLow = rhs & 0xffffffffULL;
+	Lupus::ullong high = lhsHigh * rhsHigh, low = lhsLow * rhsLow;
+	Lupus::ullong middle0 = lhsHigh * rhsLow, middle1 = rhsHigh * lhsLow;
+	Lupus::ullong sum = low + (middle0 << 32);
+	Lupus::ullong carry = (sum < low);
+
+	low = sum + (middle1 << 32);
+	carry += (low < sum);
+	lhs = low;
+	rhs = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+}
+
+static Lupus::ullong Mix(Lupus::ullong lhs, Lupus::ullong rhs)
+{
+	Multiply(lhs, rhs);
+	return (lhs ^ rhs);
+}
+
+static Lupus::ullong Fold(Lupus::ullong word)
+{
+	// high bit of every byte within 'A' to 'Z', bytes above 127 are never letters
+	Lupus::ullong low = word & (sOnes * 0x7f);
+	Lupus::ullong above = low + sOnes * (0x80 - 'A');
+	Lupus::ullong beyond = low + sOnes * (0x80 - 'Z' - 1);
+	Lupus::ullong letters = above & ~beyond & ~word & (sOnes * 0x80);
+
+	return (word | (letters >> 2));
+}
+
+static Lupus::ullong Read8(const unsigned char* data, bool insensitive)
+{
+	Lupus::ullong result;
+	memcpy(&result, data, 8);
+	return (insensitive ? Fold(result) : result);
+}
+
+static Lupus::ullong Read4(const unsigned char* data, bool insensitive)
+{
+	Lupus::uint result;
+	memcpy(&result, data, 4);
+	return (insensitive ? Fold(result) : result);
+}
+
+static Lupus::ullong Read3(const unsigned char* data, int length, bool insensitive)
+{
+	Lupus::ullong result = (static_cast<Lupus::ullong>(data[0]) << 16) | (static_cast<Lupus::ullong>(data[length >> 1]) << 8) | data[length - 1];
+	return (insensitive ? Fold(result) : result);
+}
+
+namespace Lupus {
+	namespace System {
+		ullong HashChars(const char* text, int textLength, CaseSensitivity sensitivity, ullong seed)
+		{
+			// variables
+			const unsigned char* data = reinterpret_cast<const unsigned char*>(text);
+			bool insensitive = (sensitivity == CaseSensitivity::CaseInsensitive);
+			ullong length = static_cast<ullong>(textLength);
+			ullong a = 0;
+			ullong b = 0;
+
+			// compute result
+			seed ^= Mix(seed ^ sSecret[0], sSecret[1]);
+
+			if (textLength <= 16) {
+				if (textLength >= 4) {
+					int offset = (textLength >> 3) << 2;
+					a = (Read4(data, insensitive) << 32) | Read4(data + offset, insensitive);
+					b = (Read4(data + textLength - 4, insensitive) << 32) | Read4(data + textLength - 4 - offset, insensitive);
+				} else if (textLength > 0) {
+					a = Read3(data, textLength, insensitive);
+				}
+			} else {
+				int remaining = textLength;
+
+				// three independent lanes of 16 bytes each
+				if (remaining > 48) {
+					ullong seed1 = seed;
+					ullong seed2 = seed;
+
+					do {
+						seed = Mix(Read8(data, insensitive) ^ sSecret[1], Read8(data + 8, insensitive) ^ seed);
+						seed1 = Mix(Read8(data + 16, insensitive) ^ sSecret[2], Read8(data + 24, insensitive) ^ seed1);
+						seed2 = Mix(Read8(data + 32, insensitive) ^ sSecret[3], Read8(data + 40, insensitive) ^ seed2);
+						data += 48;
+						remaining -= 48;
+					} while (remaining > 48);
+
+					seed ^= seed1 ^ seed2;
+				}
+
+				while (remaining > 16) {
+					seed = Mix(Read8(data, insensitive) ^ sSecret[1], Read8(data + 8, insensitive) ^ seed);
+					data += 16;
+					remaining -= 16;
+				}
+
+				// last 16 bytes, may overlap with the previous round
+				a = Read8(data + remaining - 16, insensitive);
+				b = Read8(data + remaining - 8, insensitive);
+			}
+
+			a ^= sSecret[1];
+			b ^= seed;
+			Multiply(a, b);
+
+			return Mix(a ^ sSecret[0] ^ length, b ^ sSecret[1]);
+		}
+	}
+}
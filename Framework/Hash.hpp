@@ -0,0 +1,42 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_HASH_HPP
+#define LUPUS_HASH_HPP
+
+#include "Types.hpp"
+
+namespace Lupus {
+	namespace System {
+		/**
+		 * computes a seeded hash of a char range
+		 *
+		 * wyhash style multiply and mix hash processing 48 bytes per round. case insensitive
+		 * hashing folds ascii letters eight at a time, so it matches case insensitive comparison.
+		 *
+		 * @param text chars to hash
+		 * @param textLength length of text
+		 * @param sensitivity case sensitivity of the hash
+		 * @param seed seed mixed into the hash
+		 * @return 64 bit hash, equal for equal char ranges and seeds
+		 */
+		LUPUS_API ullong HashChars(const char* text, int textLength, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive, ullong seed = 0);
+	}
+}
+
+#endif
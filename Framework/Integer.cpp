@@ -19,331 +19,761 @@
 #include "Integer.hpp"
 #include "Char.hpp"
 #include "String.hpp"
-#include <cstdio>
+#include "StringView.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+#include <climits>
 #include <cstring>
+#include <limits>
 
 static const size_t sIntegerCount = 32;
 
+//! decimal digits of every value below 100
+static const char sDecimalPairs[201] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+//! hexadecimal digits of every byte value
+static const char sHexadecimalPairs[513] =
+	"000102030405060708090a0b0c0d0e0f"
+	"101112131415161718191a1b1c1d1e1f"
+	"202122232425262728292a2b2c2d2e2f"
+	"303132333435363738393a3b3c3d3e3f"
+	"404142434445464748494a4b4c4d4e4f"
+	"505152535455565758595a5b5c5d5e5f"
+	"606162636465666768696a6b6c6d6e6f"
+	"707172737475767778797a7b7c7d7e7f"
+	"808182838485868788898a8b8c8d8e8f"
+	"909192939495969798999a9b9c9d9e9f"
+	"a0a1a2a3a4a5a6a7a8a9aaabacadaeaf"
+	"b0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+	"c0c1c2c3c4c5c6c7c8c9cacbcccdcecf"
+	"d0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+	"e0e1e2e3e4e5e6e7e8e9eaebecedeeef"
+	"f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+//! octal digits of every value below 64
+static const char sOctalPairs[129] =
+	"00010203040506071011121314151617"
+	"20212223242526273031323334353637"
+	"40414243444546475051525354555657"
+	"60616263646566677071727374757677";
+
+static char* WriteDecimal(char* begin, Lupus::uint value)
+{
+	// two digits per division, written backwards
+	while (value >= 100) {
+		Lupus::uint pair = value % 100;
+		value /= 100;
+		begin -= 2;
+		memcpy(begin, sDecimalPairs + pair * 2, 2);
+	}
+
+	if (value >= 10) {
+		begin -= 2;
+		memcpy(begin, sDecimalPairs + value * 2, 2);
+	} else {
+		*--begin = static_cast<char>('0' + value);
+	}
+
+	return begin;
+}
+
+static int CopyDigits(char* buffer, const char* begin, const char* end)
+{
+	// variables
+	int length = static_cast<int>(end - begin);
+
+	// copy to caller storage
+	memcpy(buffer, begin, length);
+	buffer[length] = 0;
+	return length;
+}
+
+static int FormatDecimal(char* buffer, Lupus::ullong value)
+{
+	// variables
+	char digits[sIntegerCount];
+	char* end = digits + sIntegerCount;
+	char* begin = end;
+
+	// 64 bit divisions are slow on 32 bit targets, split off eight digits at a time
+	while (value > 0xffffffffULL) {
+		Lupus::uint low = static_cast<Lupus::uint>(value % 100000000);
+		value /= 100000000;
+
+		for (int i = 0; i < 4; i++) {
+			begin -= 2;
+			memcpy(begin, sDecimalPairs + (low % 100) * 2, 2);
+			low /= 100;
+		}
+	}
+
+	begin = WriteDecimal(begin, static_cast<Lupus::uint>(value));
+	return CopyDigits(buffer, begin, end);
+}
+
+static int FormatHexadecimal(char* buffer, Lupus::ullong value)
+{
+	// variables
+	char digits[sIntegerCount];
+	char* end = digits + sIntegerCount;
+	char* begin = end;
+
+	// zero has no prefix, like printf with %#x
+	if (!value) {
+		return CopyDigits(buffer, "0", "0" + 1);
+	}
+
+	// two digits per byte, written backwards
+	while (value) {
+		begin -= 2;
+		memcpy(begin, sHexadecimalPairs + (value & 0xff) * 2, 2);
+		value >>= 8;
+	}
+
+	// drop leading zero of the last pair, add prefix
+	begin += (*begin == '0');
+	*--begin = 'x';
+	*--begin = '0';
+	return CopyDigits(buffer, begin, end);
+}
+
+static int FormatOctal(char* buffer, Lupus::ullong value)
+{
+	// variables
+	char digits[sIntegerCount];
+	char* end = digits + sIntegerCount;
+	char* begin = end;
+
+	// zero has no prefix, like printf with %#o
+	if (!value) {
+		return CopyDigits(buffer, "0", "0" + 1);
+	}
+
+	// two digits per six bits, written backwards
+	while (value) {
+		begin -= 2;
+		memcpy(begin, sOctalPairs + (value & 0x3f) * 2, 2);
+		value >>= 6;
+	}
+
+	// a leading zero of the last pair serves as prefix
+	if (*begin != '0') {
+		*--begin = '0';
+	}
+
+	return CopyDigits(buffer, begin, end);
+}
+
+static int FormatUnsigned(char* buffer, Lupus::ullong value, Lupus::System::IntegerBase base)
+{
+	switch (base) {
+	case Lupus::System::IntegerBase::Hexadecimal:
+		return FormatHexadecimal(buffer, value);
+	case Lupus::System::IntegerBase::Octal:
+		return FormatOctal(buffer, value);
+	default:
+		return FormatDecimal(buffer, value);
+	}
+}
+
+static int FormatSigned(char* buffer, Lupus::llong value, Lupus::ullong bits, Lupus::System::IntegerBase base)
+{
+	// hexadecimal and octal show the two's complement within the value's own width
+	if (base != Lupus::System::IntegerBase::Decimal || value >= 0) {
+		return FormatUnsigned(buffer, bits, base);
+	}
+
+	// negate unsigned, so the smallest value doesn't overflow
+	buffer[0] = '-';
+	return FormatDecimal(buffer + 1, 0 - static_cast<Lupus::ullong>(value)) + 1;
+}
+
+static bool IsEightDigits(Lupus::ullong word)
+{
+	// every byte within '0' to '9', adding 6 carries digits above '9' into the high nibble
+	return ((word & 0xf0f0f0f0f0f0f0f0ULL) | (((word + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+static Lupus::uint ParseEightDigits(Lupus::ullong word)
+{
+	// first char is the lowest byte, combine pairs, then quadruples, then both halves
+	word -= 0x3030303030303030ULL;
+	word = (word * 10) + (word >> 8);
+	word = (((word & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32))) +
+		(((word >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32)))) >> 32;
+	return static_cast<Lupus::uint>(word);
+}
+
+static int ParseDecimal(const char* text, int length, Lupus::ullong& result)
+{
+	// variables
+	Lupus::ullong value = 0;
+	int i = 0;
+
+	// leading zeros don't count towards the 19 digits which always fit
+	while (i < length && text[i] == '0') {
+		i++;
+	}
+
+	int start = i;
+
+	// eight digits per step, assumes little endian byte order
+	while (i + 8 <= length && i - start + 8 <= 19) {
+		Lupus::ullong word;
+		memcpy(&word, text + i, 8);
+
+		if (!IsEightDigits(word)) {
+			break;
+		}
+
+		value = value * 100000000 + ParseEightDigits(word);
+		i += 8;
+	}
+
+	// remaining digits one at a time, checked for overflow beyond 19 digits
+	while (i < length && text[i] >= '0' && text[i] <= '9') {
+		Lupus::uint digit = text[i] - '0';
+
+		if (i - start >= 19 && value > (ULLONG_MAX - digit) / 10) {
+			return -1;
+		}
+
+		value = value * 10 + digit;
+		i++;
+	}
+
+	result = value;
+	return i;
+}
+
+static int ParsePowerOfTwo(const char* text, int length, int shift, Lupus::ullong maximum, Lupus::ullong& result)
+{
+	// variables
+	Lupus::ullong value = 0;
+	int i = 0;
+
+	while (i < length) {
+		// digit value, letters only for hexadecimal
+		unsigned int digit = static_cast<unsigned char>(text[i]) - '0';
+
+		if (digit > 9 && shift == 4) {
+			digit = (static_cast<unsigned char>(text[i]) | 0x20) - 'a' + 10;
+			digit = (digit >= 10 && digit < 16) ? digit : 16;
+		}
+
+		if (digit >= (1u << shift)) {
+			break;
+		} else if (value > (maximum >> shift)) {
+			return -1;
+		}
+
+		value = (value << shift) | digit;
+		i++;
+	}
+
+	result = value;
+	return i;
+}
+
+template <typename T, typename U>
+static int ParseInteger(const char* text, int length, Lupus::System::IntegerBase base, T& result)
+{
+	// variables
+	Lupus::ullong value = 0;
+	bool negative = false;
+	int prefix = 0;
+	int digits = 0;
+
+	// hexadecimal and octal fill the whole width of the type, decimal may have a sign
+	if (base == Lupus::System::IntegerBase::Hexadecimal) {
+		if (length > 2 && text[0] == '0' && (text[1] | 0x20) == 'x') {
+			prefix = 2;
+		}
+
+		digits = ParsePowerOfTwo(text + prefix, length - prefix, 4, (std::numeric_limits<U>::max)(), value);
+
+		// without following digits the prefix is just a zero
+		if (!digits && prefix) {
+			prefix = 0;
+			digits = 1;
+		}
+	} else if (base == Lupus::System::IntegerBase::Octal) {
+		digits = ParsePowerOfTwo(text, length, 3, (std::numeric_limits<U>::max)(), value);
+	} else {
+		if (length > 0 && (text[0] == '+' || (text[0] == '-' && std::numeric_limits<T>::is_signed))) {
+			negative = (text[0] == '-');
+			prefix = 1;
+		}
+
+		digits = ParseDecimal(text + prefix, length - prefix, value);
+
+		// negative values may exceed the positive maximum by one
+		Lupus::ullong maximum = static_cast<Lupus::ullong>((std::numeric_limits<T>::max)()) + (negative ? 1 : 0);
+
+		if (value > maximum) {
+			return 0;
+		}
+
+		value = negative ? 0 - value : value;
+	}
+
+	// a prefix without digits isn't a number
+	if (digits <= 0) {
+		return 0;
+	}
+
+	result = static_cast<T>(static_cast<U>(value));
+	return prefix + digits;
+}
+
+template <typename T, typename U>
+static bool ParseWhole(const Lupus::System::StringView& string, T& result, Lupus::System::IntegerBase base)
+{
+	// variables
+	T value;
+
+	// trailing chars make the whole string invalid
+	if (ParseInteger<T, U>(string.Data(), string.Length(), base, value) != string.Length() || string.IsEmpty()) {
+		return false;
+	}
+
+	result = value;
+	return true;
+}
+
+template <typename T, typename U>
+static bool ParseFields(const Lupus::System::StringView& text, char delimiter, Lupus::System::Vector<T>& values, Lupus::System::Vector<int>& errors, Lupus::System::IntegerBase base)
+{
+	// variables
+	const char* data = text.Data();
+	int length = text.Length();
+	int start = values.Length;
+	int position = 0;
+	bool result = true;
+
+	if (!length) {
+		return true;
+	}
+
+	// one entry per field, so the vector grows only once
+	int fields = Lupus::System::CountChar(data, length, delimiter) + 1;
+	values.Resize(start + fields);
+	T* output = values.Data;
+
+	for (int i = start; i < start + fields; i++) {
+		int end = Lupus::System::FindChar(data + position, length - position, delimiter);
+		end = (end < 0) ? length : position + end;
+
+		// the whole field has to be a number
+		if (end == position || ParseInteger<T, U>(data + position, end - position, base, output[i]) != end - position) {
+			output[i] = T();
+			errors.Add(i);
+			result = false;
+		}
+
+		position = end + 1;
+	}
+
+	return result;
+}
+
 namespace Lupus {
 	namespace System {
+		const int Integer::MaxFormatLength;
+
 		String Integer::ToString(sbyte value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%hhd"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#hhx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#hho"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(short value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%hd"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#hx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#ho"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(int value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%d"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#x"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#o"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(long value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%ld"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#lx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#lo"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(llong value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%lld"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#llx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#llo"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(ubyte value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%hhu"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#hhx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#hho"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(ushort value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%hu"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#hx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#ho"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(uint value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%u"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#x"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#o"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(ulong value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%lu"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#lx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#lo"), value);
-				break;
-			}
-			return result;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
 		}
 
 		String Integer::ToString(ullong value, IntegerBase base)
 		{
+			// variables
 			char result[sIntegerCount];
-			memset(result, 0, sIntegerCount);
-
-			switch (base) {
-			case IntegerBase::Decimal:
-				snprintf(result, sIntegerCount, ("%llu"), value);
-				break;
-			case IntegerBase::Hexadecimal:
-				snprintf(result, sIntegerCount, ("%#llx"), value);
-				break;
-			case IntegerBase::Octal:
-				snprintf(result, sIntegerCount, ("%#llo"), value);
-				break;
-			}
-			return result;
-		}
-
-		bool Integer::TryParse(const String& string, sbyte& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%hhd"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%hhx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%hho"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, short& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%hd"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%hx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%ho"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, int& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%d"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%x"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%o"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, long& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%ld"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%lx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%lo"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, llong& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%lld"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%llx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%llo"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, ubyte& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%hhu"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%hhx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%hho"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, ushort& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%hu"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%hx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%ho"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, uint& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%u"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%x"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%o"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, ulong& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%lu"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%lx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%lo"), &result) == 1);
-			}
-			return false;
-		}
-
-		bool Integer::TryParse(const String& string, ullong& result, IntegerBase base)
-		{
-			switch (base) {
-			case IntegerBase::Decimal:
-				return (sscanf(string.Data, ("%llu"), &result) == 1);
-			case IntegerBase::Hexadecimal:
-				return (sscanf(string.Data, ("%llx"), &result) == 1);
-			case IntegerBase::Octal:
-				return (sscanf(string.Data, ("%llo"), &result) == 1);
-			}
-			return false;
+			int length = FormatTo(result, value, base);
+
+			return String(StringView(result, length));
+		}
+
+		int Integer::FormatTo(char* buffer, sbyte value, IntegerBase base)
+		{
+			return FormatSigned(buffer, value, static_cast<ubyte>(value), base);
+		}
+
+		int Integer::FormatTo(char* buffer, short value, IntegerBase base)
+		{
+			return FormatSigned(buffer, value, static_cast<ushort>(value), base);
+		}
+
+		int Integer::FormatTo(char* buffer, int value, IntegerBase base)
+		{
+			return FormatSigned(buffer, value, static_cast<uint>(value), base);
+		}
+
+		int Integer::FormatTo(char* buffer, long value, IntegerBase base)
+		{
+			return FormatSigned(buffer, value, static_cast<ulong>(value), base);
+		}
+
+		int Integer::FormatTo(char* buffer, llong value, IntegerBase base)
+		{
+			return FormatSigned(buffer, value, static_cast<ullong>(value), base);
+		}
+
+		int Integer::FormatTo(char* buffer, ubyte value, IntegerBase base)
+		{
+			return FormatUnsigned(buffer, value, base);
+		}
+
+		int Integer::FormatTo(char* buffer, ushort value, IntegerBase base)
+		{
+			return FormatUnsigned(buffer, value, base);
+		}
+
+		int Integer::FormatTo(char* buffer, uint value, IntegerBase base)
+		{
+			return FormatUnsigned(buffer, value, base);
+		}
+
+		int Integer::FormatTo(char* buffer, ulong value, IntegerBase base)
+		{
+			return FormatUnsigned(buffer, value, base);
+		}
+
+		int Integer::FormatTo(char* buffer, ullong value, IntegerBase base)
+		{
+			return FormatUnsigned(buffer, value, base);
+		}
+
+		String& Integer::AppendTo(String& string, sbyte value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, short value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, int value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, long value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, llong value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, ubyte value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, ushort value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, uint value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, ulong value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		String& Integer::AppendTo(String& string, ullong value, IntegerBase base)
+		{
+			// variables
+			char result[sIntegerCount];
+			int length = FormatTo(result, value, base);
+
+			return string.Append(result, length);
+		}
+
+		bool Integer::TryParse(const StringView& string, sbyte& result, IntegerBase base)
+		{
+			return ParseWhole<sbyte, ubyte>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, short& result, IntegerBase base)
+		{
+			return ParseWhole<short, ushort>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, int& result, IntegerBase base)
+		{
+			return ParseWhole<int, uint>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, long& result, IntegerBase base)
+		{
+			return ParseWhole<long, ulong>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, llong& result, IntegerBase base)
+		{
+			return ParseWhole<llong, ullong>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, ubyte& result, IntegerBase base)
+		{
+			return ParseWhole<ubyte, ubyte>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, ushort& result, IntegerBase base)
+		{
+			return ParseWhole<ushort, ushort>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, uint& result, IntegerBase base)
+		{
+			return ParseWhole<uint, uint>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, ulong& result, IntegerBase base)
+		{
+			return ParseWhole<ulong, ulong>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, ullong& result, IntegerBase base)
+		{
+			return ParseWhole<ullong, ullong>(string, result, base);
+		}
+
+		bool Integer::TryParse(const StringView& string, sbyte& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<sbyte, ubyte>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, short& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<short, ushort>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, int& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<int, uint>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, long& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<long, ulong>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, llong& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<llong, ullong>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, ubyte& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<ubyte, ubyte>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, ushort& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<ushort, ushort>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, uint& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<uint, uint>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, ulong& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<ulong, ulong>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::TryParse(const StringView& string, ullong& result, int& consumed, IntegerBase base)
+		{
+			consumed = ParseInteger<ullong, ullong>(string.Data(), string.Length(), base, result);
+			return (consumed > 0);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<sbyte>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<sbyte, ubyte>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<short>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<short, ushort>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<int>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<int, uint>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<long>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<long, ulong>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<llong>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<llong, ullong>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<ubyte>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<ubyte, ubyte>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<ushort>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<ushort, ushort>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<uint>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<uint, uint>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<ulong>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<ulong, ulong>(text, delimiter, values, errors, base);
+		}
+
+		bool Integer::ParseColumn(const StringView& text, char delimiter, Vector<ullong>& values, Vector<int>& errors, IntegerBase base)
+		{
+			return ParseFields<ullong, ullong>(text, delimiter, values, errors, base);
 		}
 	}
 }
@@ -20,11 +20,13 @@
 #define LUPUS_INTEGER_HPP
 
 #include "Types.hpp"
+#include "StringView.hpp"
 
 namespace Lupus {
 	namespace System {
 		// declarations
 		class String;
+		template <typename T> class Vector;
 
 		//! conversion base for integer
 		enum class IntegerBase {
@@ -37,6 +39,9 @@ namespace Lupus {
 		class LUPUS_API Integer
 		{
 		public:
+			//! buffer size required by FormatTo, including the terminating null
+			static const int MaxFormatLength = 24;
+
 			//! \sa Integer::ToString(int, IntegerBase)
 			static String ToString(sbyte value, IntegerBase base = IntegerBase::Decimal);
 			//! \sa Integer::ToString(int, IntegerBase)
@@ -63,33 +68,159 @@ namespace Lupus {
 			static String ToString(ulong value, IntegerBase base = IntegerBase::Decimal);
 			//! \sa Integer::ToString(int, IntegerBase)
 			static String ToString(ullong value, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, sbyte& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, short& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, sbyte value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, short value, IntegerBase base = IntegerBase::Decimal);
+			/**
+			 * write an integer into caller provided storage
+			 *
+			 * uses the same format as ToString, but neither allocates nor calls the c runtime.
+			 * decimal digits are written two at a time through a table of digit pairs.
+			 *
+			 * @param buffer storage for at least MaxFormatLength chars
+			 * @param value integer to convert
+			 * @param base either octal, decimal or hexadecimal
+			 * @return number of chars written, excluding the terminating null
+			 */
+			static int FormatTo(char* buffer, int value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, long value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, llong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, ubyte value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, ushort value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, uint value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, ulong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::FormatTo(char*, int, IntegerBase)
+			static int FormatTo(char* buffer, ullong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, sbyte value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, short value, IntegerBase base = IntegerBase::Decimal);
+			/**
+			 * append an integer to a string without creating a temporary string
+			 *
+			 * @param string string to append to
+			 * @param value integer to convert
+			 * @param base either octal, decimal or hexadecimal
+			 * @return given string
+			 */
+			static String& AppendTo(String& string, int value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, long value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, llong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, ubyte value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, ushort value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, uint value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, ulong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::AppendTo(String&, int, IntegerBase)
+			static String& AppendTo(String& string, ullong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, sbyte& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, short& result, IntegerBase base = IntegerBase::Decimal);
 			/**
 			 * convert a string to its respective integer value
 			 *
+			 * the whole string has to be a number. decimal numbers may have a sign, hexadecimal
+			 * numbers may have a 0x prefix. numbers out of range of the result type are rejected,
+			 * except that hexadecimal and octal numbers fill the whole width of signed types.
+			 *
 			 * @param string string to convert
 			 * @param result output argument where the conversion result is written to
 			 * @param base either octal, decimal or hexadecimal
 			 * @return true if successful, otherwise false
 			 */
-			static bool TryParse(const String& string, int& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, long& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, llong& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, ubyte& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, ushort& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, uint& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, ulong& result, IntegerBase base = IntegerBase::Decimal);
-			//! \sa Integer::TryParse(String&, int, IntegerBase)
-			static bool TryParse(const String& string, ullong& result, IntegerBase base = IntegerBase::Decimal);
+			static bool TryParse(const StringView& string, int& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, long& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, llong& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ubyte& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ushort& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, uint& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ulong& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ullong& result, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, sbyte& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, short& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			/**
+			 * convert the number at the beginning of a string
+			 *
+			 * parses as many chars as form a number and ignores the rest, so numbers can be read
+			 * from within larger buffers. decimal digits are converted eight at a time.
+			 *
+			 * @param string string starting with a number
+			 * @param result output argument where the conversion result is written to
+			 * @param consumed output argument receiving the number of parsed chars, zero on failure
+			 * @param base either octal, decimal or hexadecimal
+			 * @return true if successful, otherwise false
+			 */
+			static bool TryParse(const StringView& string, int& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, long& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, llong& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ubyte& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ushort& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, uint& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ulong& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::TryParse(const StringView&, int&, int&, IntegerBase)
+			static bool TryParse(const StringView& string, ullong& result, int& consumed, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<sbyte>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<short>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			/**
+			 * convert every field of a delimited line and append the results
+			 *
+			 * fields are found by vectorized delimiter scans and parsed in place, without
+			 * a temporary string per field. the vector grows once per call. every field
+			 * gets an entry, invalid fields get zero and their index into values is
+			 * appended to errors, so a whole column can be checked at once.
+			 *
+			 * @param text delimited numbers, an empty text has no fields
+			 * @param delimiter char between two fields
+			 * @param values vector the converted fields are appended to
+			 * @param errors vector the indices of invalid fields are appended to
+			 * @param base either octal, decimal or hexadecimal
+			 * @return true if every field is a number, otherwise false
+			 */
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<int>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<long>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<llong>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<ubyte>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<ushort>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<uint>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<ulong>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
+			//! \sa Integer::ParseColumn(const StringView&, char, Vector<int>&, Vector<int>&, IntegerBase)
+			static bool ParseColumn(const StringView& text, char delimiter, Vector<ullong>& values, Vector<int>& errors, IntegerBase base = IntegerBase::Decimal);
 		};
 	}
 }
@@ -113,6 +113,7 @@ namespace Lupus {
 	Pointer<T>& Pointer<T>::operator=(Pointer<T>&& pointer)
 	{
 		Swap(_pointer, pointer._pointer);
+		return (*this);
 	}
 
 	template <typename T>
@@ -123,5 +124,6 @@ namespace Lupus {
 		}
 
 		_pointer = pointer;
+		return (*this);
 	}
 }
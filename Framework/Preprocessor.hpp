@@ -32,6 +32,14 @@
 #  error platform not supported
 #endif
 
+// constexpr support, visual c++ 2013 doesn't know it
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+#  define LUPUS_HAS_CONSTEXPR
+#  define LUPUS_CONSTEXPR constexpr
+#else
+#  define LUPUS_CONSTEXPR
+#endif
+
 // DLL export symbols
 #if defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #  ifdef LUPUS_DLL_EXPORT
@@ -0,0 +1,180 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedString.hpp"
+#include "StringView.hpp"
+#include "String.hpp"
+#include "Exception.hpp"
+#include "Simd.hpp"
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+using namespace Lupus::System;
+
+static SharedBlock* Allocate(const char* data, int length)
+{
+	// check argument, empty strings don't need a block
+	if (!length) {
+		return nullptr;
+	}
+
+	// variables
+	void* memory = ::operator new(offsetof(SharedBlock, data) + length + 1);
+	SharedBlock* block = static_cast<SharedBlock*>(memory);
+
+	// fill block
+	new (&block->references) std::atomic<int>(1);
+	block->length = length;
+	memcpy(block->data, data, length);
+	block->data[length] = '\0';
+	return block;
+}
+
+namespace Lupus {
+	namespace System {
+		SharedString::SharedString(const char* str) :
+			_block(nullptr)
+		{
+			// check argument
+			if (!str) {
+				throw ArgumentNullException("str must have a valid value");
+			}
+
+			_block = Allocate(str, static_cast<int>(strlen(str)));
+		}
+
+		SharedString::SharedString(const StringView& view) :
+			_block(Allocate(view.Data(), view.Length()))
+		{
+		}
+
+		void SharedString::Release()
+		{
+			// last reference frees the block
+			if (_block && _block->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				_block->references.~atomic();
+				::operator delete(_block);
+			}
+
+			_block = nullptr;
+		}
+
+		char* SharedString::MakeUnique()
+		{
+			// check state
+			if (!_block) {
+				return nullptr;
+			} else if (_block->references.load(std::memory_order_acquire) == 1) {
+				return _block->data;
+			}
+
+			// copy shared chars
+			SharedBlock* block = Allocate(_block->data, _block->length);
+			Release();
+			_block = block;
+			return _block->data;
+		}
+
+		ulong SharedString::GetHashCode(CaseSensitivity sensitivity) const
+		{
+			return View().GetHashCode(sensitivity);
+		}
+
+		StringView SharedString::View() const
+		{
+			return StringView(Data(), Length());
+		}
+
+		String SharedString::ToString() const
+		{
+			return String(View());
+		}
+
+		SharedString& SharedString::ToLower()
+		{
+			ToLowerChars(MakeUnique(), Length());
+			return (*this);
+		}
+
+		SharedString& SharedString::ToUpper()
+		{
+			ToUpperChars(MakeUnique(), Length());
+			return (*this);
+		}
+
+		SharedString& SharedString::Transform(const ubyte* table)
+		{
+			// check argument
+			if (!table) {
+				throw ArgumentNullException("table must have a valid value");
+			}
+
+			TransformChars(MakeUnique(), Length(), table);
+			return (*this);
+		}
+
+		SharedString& SharedString::operator=(const SharedString& string)
+		{
+			// variables
+			SharedBlock* block = string._block;
+
+			// increment first, so self assignment keeps the block alive
+			if (block) {
+				block->references.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			Release();
+			_block = block;
+			return (*this);
+		}
+
+		SharedString& SharedString::operator=(SharedString&& string)
+		{
+			if (this != &string) {
+				Release();
+				_block = string._block;
+				string._block = nullptr;
+			}
+
+			return (*this);
+		}
+
+		const char& SharedString::operator[](int index) const
+		{
+			if (index >= Length()) {
+				throw ArgumentOutOfRangeException("index exceeds string length");
+			} else if (index < 0) {
+				throw ArgumentOutOfRangeException("index must be greater than zero");
+			}
+
+			return (_block->data[index]);
+		}
+
+		bool SharedString::operator==(const SharedString& string) const
+		{
+			// shared chars are equal without comparing them
+			return (_block == string._block || View() == string.View());
+		}
+
+		bool SharedString::operator!=(const SharedString& string) const
+		{
+			return !(*this == string);
+		}
+	}
+}
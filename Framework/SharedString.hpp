@@ -0,0 +1,154 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_SHAREDSTRING_HPP
+#define LUPUS_SHAREDSTRING_HPP
+
+#include "Types.hpp"
+#include <atomic>
+
+namespace Lupus {
+	namespace System {
+		// declarations
+		class String;
+		class StringView;
+
+		//! chars shared between strings, allocated together with its header
+		struct SharedBlock
+		{
+			//! number of strings referencing this block
+			std::atomic<int> references;
+			//! number of chars
+			int length;
+			//! null terminated chars
+			char data[1];
+		};
+
+		/**
+		 * reference counted string with cheap copies
+		 *
+		 * counter, length and chars are stored within a single allocation. copying or assigning
+		 * only increments the counter, so shared strings can be passed by value between threads.
+		 * modifying methods copy the chars first if the block is shared with another string.
+		 */
+		class LUPUS_API SharedString
+		{
+			//! shared chars, nullptr for an empty string
+			SharedBlock* _block;
+
+			void Release();
+			char* MakeUnique();
+		public:
+			//! Create an empty string without allocating
+			SharedString();
+			/**
+			 * Copy a null terminated native string
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 *
+			 * @param str native string
+			 */
+			SharedString(const char* str);
+			/**
+			 * Copy the viewed chars
+			 *
+			 * @param view chars to be copied
+			 */
+			SharedString(const StringView& view);
+			//! Share the chars of given string
+			SharedString(const SharedString& string);
+			//! Take over the chars of given string
+			SharedString(SharedString&& string);
+			//! Release the shared chars
+			~SharedString();
+			//! Return the chars, null terminated
+			const char* Data() const;
+			//! Return number of chars
+			int Length() const;
+			//! Check if this string is empty
+			bool IsEmpty() const;
+			//! Check if no other string shares these chars
+			bool IsUnique() const;
+			/**
+			 * Compute a hash code from the chars
+			 *
+			 * equal to the hash code of a view with the same content
+			 *
+			 * @param sensitivity flag for case sensitivity
+			 * @return hash code
+			 */
+			ulong GetHashCode(CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			//! Create a view onto the chars
+			StringView View() const;
+			/**
+			 * Copy the chars into a new string
+			 *
+			 * @return new string
+			 */
+			String ToString() const;
+			/**
+			 * Convert all upper case letters to lower case
+			 *
+			 * copies the chars first if they are shared
+			 *
+			 * @return this instance
+			 */
+			SharedString& ToLower();
+			/**
+			 * Convert all lower case letters to upper case
+			 *
+			 * copies the chars first if they are shared
+			 *
+			 * @return this instance
+			 */
+			SharedString& ToUpper();
+			/**
+			 * Replace every char through a lookup table
+			 *
+			 * copies the chars first if they are shared
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 *
+			 * @param table replacement for every unsigned char value, 256 entries
+			 * @return this instance
+			 */
+			SharedString& Transform(const ubyte* table);
+			//! Share the chars of given string
+			SharedString& operator=(const SharedString& string);
+			//! Take over the chars of given string
+			SharedString& operator=(SharedString&& string);
+			/**
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @return char at given index
+			 */
+			const char& operator[](int index) const;
+			//! Compare two strings char by char
+			bool operator==(const SharedString& string) const;
+			//! Compare two strings char by char
+			bool operator!=(const SharedString& string) const;
+		};
+	}
+}
+
+#include "SharedString.inl"
+
+#endif
@@ -0,0 +1,65 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+namespace Lupus {
+	namespace System {
+		inline SharedString::SharedString() :
+			_block(nullptr)
+		{
+		}
+
+		inline SharedString::SharedString(const SharedString& string) :
+			_block(string._block)
+		{
+			if (_block) {
+				_block->references.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		inline SharedString::SharedString(SharedString&& string) :
+			_block(string._block)
+		{
+			string._block = nullptr;
+		}
+
+		inline SharedString::~SharedString()
+		{
+			Release();
+		}
+
+		inline const char* SharedString::Data() const
+		{
+			return (_block ? _block->data : "");
+		}
+
+		inline int SharedString::Length() const
+		{
+			return (_block ? _block->length : 0);
+		}
+
+		inline bool SharedString::IsEmpty() const
+		{
+			return (Length() == 0);
+		}
+
+		inline bool SharedString::IsUnique() const
+		{
+			return (!_block || _block->references.load(std::memory_order_acquire) == 1);
+		}
+	}
+}
@@ -0,0 +1,1374 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Simd.hpp"
+#include "CharSet.hpp"
+#include "Vector.hpp"
+#include <cctype>
+#include <cstring>
+
+// vectorized scans need at least sse2
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#  define LUPUS_SIMD_X86
+#endif
+
+#ifdef LUPUS_SIMD_X86
+#  include <immintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#    define LUPUS_TARGET_SSSE3
+#    define LUPUS_TARGET_AVX2
+#  else
+#    include <cpuid.h>
+#    define LUPUS_TARGET_SSSE3 __attribute__((target("ssse3")))
+#    define LUPUS_TARGET_AVX2 __attribute__((target("avx2")))
+#  endif
+#endif
+
+namespace {
+	//! pattern prepared for block filtering
+	struct Pattern
+	{
+		//! pattern
+		const char* data;
+		//! pattern length
+		int length;
+		//! accepted values of first char
+		char first[2];
+		//! accepted values of last char
+		char last[2];
+		//! compare pattern case insensitive
+		bool insensitive;
+	};
+}
+
+namespace Lupus {
+	namespace System {
+		const ubyte AsciiLowerTable[256] = {
+			0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+			0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+			0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+			0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+			0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+			0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+			0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+			0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+			0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+			0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+			0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+			0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+			0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+			0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+			0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+			0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+		};
+
+		const ubyte AsciiUpperTable[256] = {
+			0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+			0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+			0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+			0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+			0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+			0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+			0x60, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+			0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+			0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+			0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+			0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+			0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+			0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+			0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+			0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+			0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+		};
+	}
+}
+
+static void GetCases(char ch, Lupus::System::CaseSensitivity sensitivity, char* cases)
+{
+	if (sensitivity == Lupus::System::CaseSensitivity::CaseInsensitive) {
+		cases[0] = static_cast<char>(Lupus::System::AsciiLowerTable[static_cast<unsigned char>(ch)]);
+		cases[1] = static_cast<char>(Lupus::System::AsciiUpperTable[static_cast<unsigned char>(ch)]);
+	} else {
+		cases[0] = cases[1] = ch;
+	}
+}
+
+static bool Verify(const char* text, const Pattern& pattern)
+{
+	// first and last char are already matched
+	if (!pattern.insensitive) {
+		return (memcmp(text + 1, pattern.data + 1, pattern.length - 2) == 0);
+	}
+
+	// variables
+	const Lupus::ubyte* table = Lupus::System::AsciiLowerTable;
+
+	for (int i = 1; i < pattern.length - 1; i++) {
+		if (table[static_cast<unsigned char>(text[i])] != table[static_cast<unsigned char>(pattern.data[i])]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int FindCharScalar(const char* text, int startIndex, int textLength, const char* cases)
+{
+	for (int i = startIndex; i < textLength; i++) {
+		if (text[i] == cases[0] || text[i] == cases[1]) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int CountCharScalar(const char* text, int startIndex, int textLength, char ch)
+{
+	// variables
+	int result = 0;
+
+	for (int i = startIndex; i < textLength; i++) {
+		result += (text[i] == ch);
+	}
+
+	return result;
+}
+
+static int FindLastCharScalar(const char* text, int textLength, const char* cases)
+{
+	for (int i = textLength - 1; i >= 0; i--) {
+		if (text[i] == cases[0] || text[i] == cases[1]) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int FindAnyCharScalar(const char* text, int startIndex, int textLength, const Lupus::System::CharSet& set)
+{
+	for (int i = startIndex; i < textLength; i++) {
+		if (set.Contains(text[i])) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int FindLastAnyCharScalar(const char* text, int textLength, const Lupus::System::CharSet& set)
+{
+	for (int i = textLength - 1; i >= 0; i--) {
+		if (set.Contains(text[i])) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int CompareCharsScalar(const char* lhs, const char* rhs, int startIndex, int length, bool insensitive)
+{
+	// variables
+	const unsigned char* left = reinterpret_cast<const unsigned char*>(lhs);
+	const unsigned char* right = reinterpret_cast<const unsigned char*>(rhs);
+
+	// compute result
+	for (int i = startIndex; i < length; i++) {
+		int lch = insensitive ? Lupus::System::AsciiLowerTable[left[i]] : left[i];
+		int rch = insensitive ? Lupus::System::AsciiLowerTable[right[i]] : right[i];
+
+		if (lch != rch) {
+			return (lch - rch);
+		}
+	}
+
+	return 0;
+}
+
+static int ConvertCaseScalar(char* text, int startIndex, int endIndex, int textLength, bool upper)
+{
+	// variables
+	const unsigned char* table = upper ? Lupus::System::AsciiUpperTable : Lupus::System::AsciiLowerTable;
+	int i = startIndex;
+
+	// ascii by table, utf-8 encoded latin-1 letters by their second byte
+	while (i < endIndex) {
+		unsigned char ch = static_cast<unsigned char>(text[i]);
+
+		if (ch == 0xc3 && i + 1 < textLength) {
+			unsigned char next = static_cast<unsigned char>(text[i + 1]);
+
+			if (!upper && next >= 0x80 && next <= 0x9e && next != 0x97) {
+				text[i + 1] = static_cast<char>(next + 0x20);
+			} else if (upper && next >= 0xa0 && next <= 0xbe && next != 0xb7) {
+				text[i + 1] = static_cast<char>(next - 0x20);
+			}
+
+			i += 2;
+		} else {
+			text[i] = static_cast<char>(table[ch]);
+			i++;
+		}
+	}
+
+	return i;
+}
+
+static void TransformScalar(char* text, int startIndex, int textLength, const unsigned char* table)
+{
+	for (int i = startIndex; i < textLength; i++) {
+		text[i] = static_cast<char>(table[static_cast<unsigned char>(text[i])]);
+	}
+}
+
+static int Utf8SequenceLength(const unsigned char* text, int index, int textLength)
+{
+	// variables
+	unsigned char lead = text[index];
+	int remaining = textLength - index;
+	unsigned char low = 0x80, high = 0xbf;
+
+	// check lead byte, overlong encodings, surrogates and code points above 0x10ffff
+	if (lead < 0x80) {
+		return 1;
+	} else if (lead < 0xc2 || lead > 0xf4) {
+		return 0;
+	} else if (lead < 0xe0) {
+		return (remaining >= 2 && (text[index + 1] & 0xc0) == 0x80) ? 2 : 0;
+	} else if (lead == 0xe0 || lead == 0xf0) {
+		low = (lead == 0xe0) ? 0xa0 : 0x90;
+	} else if (lead == 0xed || lead == 0xf4) {
+		high = (lead == 0xed) ? 0x9f : 0x8f;
+	}
+
+	// check continuation bytes
+	int length = (lead < 0xf0) ? 3 : 4;
+
+	if (remaining < length || text[index + 1] < low || text[index + 1] > high) {
+		return 0;
+	}
+
+	for (int i = 2; i < length; i++) {
+		if ((text[index + i] & 0xc0) != 0x80) {
+			return 0;
+		}
+	}
+
+	return length;
+}
+
+static int FindInvalidUtf8Scalar(const unsigned char* text, int startIndex, int textLength)
+{
+	// variables
+	int i = startIndex;
+
+	while (i < textLength) {
+		// skip ascii eight bytes at a time
+		if (i + 8 <= textLength) {
+			unsigned long long word;
+			memcpy(&word, text + i, 8);
+
+			if (!(word & 0x8080808080808080ULL)) {
+				i += 8;
+				continue;
+			}
+		}
+
+		// check a single sequence
+		int length = Utf8SequenceLength(text, i, textLength);
+
+		if (!length) {
+			return i;
+		}
+
+		i += length;
+	}
+
+	return -1;
+}
+
+static int FindStringScalar(const char* text, int startIndex, int textLength, const Pattern& pattern)
+{
+	// variables
+	int limit = textLength - pattern.length;
+	int last = pattern.length - 1;
+
+	// filter by first and last char, verify candidates
+	for (int i = startIndex; i <= limit; i++) {
+		if ((text[i] == pattern.first[0] || text[i] == pattern.first[1]) &&
+			(text[i + last] == pattern.last[0] || text[i + last] == pattern.last[1]) &&
+			Verify(text + i, pattern)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int FindLastStringScalar(const char* text, int candidates, const Pattern& pattern)
+{
+	// variables
+	int last = pattern.length - 1;
+
+	// filter by first and last char from the end, verify candidates
+	for (int i = candidates - 1; i >= 0; i--) {
+		if ((text[i] == pattern.first[0] || text[i] == pattern.first[1]) &&
+			(text[i + last] == pattern.last[0] || text[i + last] == pattern.last[1]) &&
+			Verify(text + i, pattern)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+#ifdef LUPUS_SIMD_X86
+static void BuildNibbleTables(const Lupus::System::CharSet& set, char* low, char* high)
+{
+	// low nibble selects a byte, high nibble of an ascii char selects a bit within it
+	for (int i = 0; i < 16; i++) {
+		int bits = 0;
+
+		for (int j = 0; j < 8; j++) {
+			if (set.Contains(static_cast<char>((j << 4) | i))) {
+				bits |= (1 << j);
+			}
+		}
+
+		low[i] = low[i + 16] = static_cast<char>(bits);
+		high[i] = high[i + 16] = static_cast<char>((i < 8) ? (1 << i) : 0);
+	}
+}
+
+static int FirstBit(unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return static_cast<int>(index);
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+static int LastBit(unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanReverse(&index, mask);
+	return static_cast<int>(index);
+#else
+	return (31 - __builtin_clz(mask));
+#endif
+}
+
+static void Cpuid(int* info, int leaf, int subleaf)
+{
+#ifdef _MSC_VER
+	__cpuidex(info, leaf, subleaf);
+#else
+	__cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
+#endif
+}
+
+static unsigned long long XGetBv()
+{
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	unsigned int eax, edx;
+	__asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((static_cast<unsigned long long>(edx) << 32) | eax);
+#endif
+}
+
+static int FindCharSSE2(const char* text, int textLength, const char* cases)
+{
+	// variables
+	__m128i lower = _mm_set1_epi8(cases[0]);
+	__m128i upper = _mm_set1_epi8(cases[1]);
+	int i = 0;
+
+	// 16 bytes per step
+	for (; i + 16 <= textLength; i += 16) {
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, lower), _mm_cmpeq_epi8(block, upper))));
+
+		if (mask) {
+			return (i + FirstBit(mask));
+		}
+	}
+
+	return FindCharScalar(text, i, textLength, cases);
+}
+
+static int FindLastCharSSE2(const char* text, int textLength, const char* cases)
+{
+	// variables
+	__m128i lower = _mm_set1_epi8(cases[0]);
+	__m128i upper = _mm_set1_epi8(cases[1]);
+	int i = textLength;
+
+	// 16 bytes per step from the end
+	for (; i >= 16; i -= 16) {
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i - 16));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, lower), _mm_cmpeq_epi8(block, upper))));
+
+		if (mask) {
+			return (i - 16 + LastBit(mask));
+		}
+	}
+
+	return FindLastCharScalar(text, i, cases);
+}
+
+static int CountCharSSE2(const char* text, int textLength, char ch)
+{
+	// variables
+	__m128i needle = _mm_set1_epi8(ch);
+	__m128i zero = _mm_setzero_si128();
+	__m128i total = zero;
+	int i = 0;
+
+	// matches subtract -1 from byte counters, which are summed up before they can overflow
+	while (i + 16 <= textLength) {
+		__m128i counts = zero;
+
+		for (int blocks = 0; blocks < 255 && i + 16 <= textLength; blocks++, i += 16) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+			counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(block, needle));
+		}
+
+		total = _mm_add_epi64(total, _mm_sad_epu8(counts, zero));
+	}
+
+	return _mm_cvtsi128_si32(total) + _mm_cvtsi128_si32(_mm_srli_si128(total, 8)) + CountCharScalar(text, i, textLength, ch);
+}
+
+static int FindStringSSE2(const char* text, int textLength, const Pattern& pattern)
+{
+	// variables
+	__m128i firstLower = _mm_set1_epi8(pattern.first[0]);
+	__m128i firstUpper = _mm_set1_epi8(pattern.first[1]);
+	__m128i lastLower = _mm_set1_epi8(pattern.last[0]);
+	__m128i lastUpper = _mm_set1_epi8(pattern.last[1]);
+	int last = pattern.length - 1;
+	int i = 0;
+
+	// test 16 candidate positions per step
+	for (; i + last + 16 <= textLength; i += 16) {
+		__m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+		__m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + last));
+		__m128i matchFirst = _mm_or_si128(_mm_cmpeq_epi8(blockFirst, firstLower), _mm_cmpeq_epi8(blockFirst, firstUpper));
+		__m128i matchLast = _mm_or_si128(_mm_cmpeq_epi8(blockLast, lastLower), _mm_cmpeq_epi8(blockLast, lastUpper));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(matchFirst, matchLast)));
+
+		while (mask) {
+			int index = i + FirstBit(mask);
+
+			if (Verify(text + index, pattern)) {
+				return index;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	return FindStringScalar(text, i, textLength, pattern);
+}
+
+static int FindLastStringSSE2(const char* text, int textLength, const Pattern& pattern)
+{
+	// variables
+	__m128i firstLower = _mm_set1_epi8(pattern.first[0]);
+	__m128i firstUpper = _mm_set1_epi8(pattern.first[1]);
+	__m128i lastLower = _mm_set1_epi8(pattern.last[0]);
+	__m128i lastUpper = _mm_set1_epi8(pattern.last[1]);
+	int last = pattern.length - 1;
+	int i = textLength - last;
+
+	// test 16 candidate positions per step from the end
+	for (; i >= 16; i -= 16) {
+		__m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i - 16));
+		__m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i - 16 + last));
+		__m128i matchFirst = _mm_or_si128(_mm_cmpeq_epi8(blockFirst, firstLower), _mm_cmpeq_epi8(blockFirst, firstUpper));
+		__m128i matchLast = _mm_or_si128(_mm_cmpeq_epi8(blockLast, lastLower), _mm_cmpeq_epi8(blockLast, lastUpper));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(matchFirst, matchLast)));
+
+		while (mask) {
+			int bit = LastBit(mask);
+
+			if (Verify(text + i - 16 + bit, pattern)) {
+				return (i - 16 + bit);
+			}
+
+			mask &= ~(1u << bit);
+		}
+	}
+
+	return FindLastStringScalar(text, i, pattern);
+}
+
+static __m128i FlipCaseSSE2(__m128i block, char first)
+{
+	// move the 26 letters beginning at first onto the lowest signed values, so a single compare detects them
+	__m128i shifted = _mm_add_epi8(block, _mm_set1_epi8(static_cast<char>(128 - first)));
+	__m128i letters = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + 26)));
+
+	return _mm_xor_si128(block, _mm_and_si128(letters, _mm_set1_epi8(0x20)));
+}
+
+static int CompareCharsSSE2(const char* lhs, const char* rhs, int length, bool insensitive)
+{
+	// variables
+	int i = 0;
+
+	// 16 bytes per step, the first differing byte is compared by the scalar loop
+	for (; i + 16 <= length; i += 16) {
+		__m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+		__m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+
+		if (insensitive) {
+			left = FlipCaseSSE2(left, 'A');
+			right = FlipCaseSSE2(right, 'A');
+		}
+
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right))) ^ 0xffff;
+
+		if (mask) {
+			return CompareCharsScalar(lhs, rhs, i + FirstBit(mask), length, insensitive);
+		}
+	}
+
+	return CompareCharsScalar(lhs, rhs, i, length, insensitive);
+}
+
+static void ConvertCaseSSE2(char* text, int textLength, bool upper)
+{
+	// variables
+	char first = upper ? 'a' : 'A';
+	int i = 0;
+
+	// 16 bytes per step, blocks with non ascii bytes are converted by the scalar loop
+	while (i + 16 <= textLength) {
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+
+		if (_mm_movemask_epi8(block)) {
+			i = ConvertCaseScalar(text, i, i + 16, textLength, upper);
+		} else {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(text + i), FlipCaseSSE2(block, first));
+			i += 16;
+		}
+	}
+
+	ConvertCaseScalar(text, i, textLength, textLength, upper);
+}
+
+LUPUS_TARGET_SSSE3 static unsigned int MatchNibblesSSSE3(__m128i block, __m128i low, __m128i high)
+{
+	// variables
+	__m128i nibble = _mm_set1_epi8(0x0f);
+	__m128i lowBits = _mm_shuffle_epi8(low, _mm_and_si128(block, nibble));
+	__m128i highBits = _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(block, 4), nibble));
+	__m128i miss = _mm_cmpeq_epi8(_mm_and_si128(lowBits, highBits), _mm_setzero_si128());
+
+	return (~static_cast<unsigned int>(_mm_movemask_epi8(miss)) & 0xffff);
+}
+
+LUPUS_TARGET_SSSE3 static int FindAnyCharSSSE3(const char* text, int textLength, const Lupus::System::CharSet& set)
+{
+	// variables
+	char lowTable[32];
+	char highTable[32];
+	int i = 0;
+
+	// prepare lookup tables, a single lane uses the first half
+	BuildNibbleTables(set, lowTable, highTable);
+
+	__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lowTable));
+	__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(highTable));
+
+	// 16 bytes per step
+	for (; i + 16 <= textLength; i += 16) {
+		unsigned int mask = MatchNibblesSSSE3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i)), low, high);
+
+		if (mask) {
+			return (i + FirstBit(mask));
+		}
+	}
+
+	return FindAnyCharScalar(text, i, textLength, set);
+}
+
+LUPUS_TARGET_SSSE3 static int FindLastAnyCharSSSE3(const char* text, int textLength, const Lupus::System::CharSet& set)
+{
+	// variables
+	char lowTable[32];
+	char highTable[32];
+	int i = textLength;
+
+	// prepare lookup tables, a single lane uses the first half
+	BuildNibbleTables(set, lowTable, highTable);
+
+	__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lowTable));
+	__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(highTable));
+
+	// 16 bytes per step from the end
+	for (; i >= 16; i -= 16) {
+		unsigned int mask = MatchNibblesSSSE3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i - 16)), low, high);
+
+		if (mask) {
+			return (i - 16 + LastBit(mask));
+		}
+	}
+
+	return FindLastAnyCharScalar(text, i, set);
+}
+
+LUPUS_TARGET_AVX2 static __m256i FlipCaseAVX2(__m256i block, char first)
+{
+	// move the 26 letters beginning at first onto the lowest signed values, so a single compare detects them
+	__m256i shifted = _mm256_add_epi8(block, _mm256_set1_epi8(static_cast<char>(128 - first)));
+	__m256i letters = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 26)), shifted);
+
+	return _mm256_xor_si256(block, _mm256_and_si256(letters, _mm256_set1_epi8(0x20)));
+}
+
+LUPUS_TARGET_AVX2 static void ConvertCaseAVX2(char* text, int textLength, bool upper)
+{
+	// variables
+	char first = upper ? 'a' : 'A';
+	int i = 0;
+
+	// 32 bytes per step, blocks with non ascii bytes are converted by the scalar loop
+	while (i + 32 <= textLength) {
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+
+		if (_mm256_movemask_epi8(block)) {
+			i = ConvertCaseScalar(text, i, i + 32, textLength, upper);
+		} else {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(text + i), FlipCaseAVX2(block, first));
+			i += 32;
+		}
+	}
+
+	ConvertCaseScalar(text, i, textLength, textLength, upper);
+}
+
+LUPUS_TARGET_AVX2 static void TransformAVX2(char* text, int textLength, const unsigned char* table)
+{
+	// variables
+	__m256i nibble = _mm256_set1_epi8(0x0f);
+	__m256i rows[16];
+	int i = 0;
+
+	// every row of 16 table entries is looked up by the low nibble and selected by the high nibble
+	for (int j = 0; j < 16; j++) {
+		rows[j] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table + j * 16)));
+	}
+
+	// 32 bytes per step
+	for (; i + 32 <= textLength; i += 32) {
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+		__m256i low = _mm256_and_si256(block, nibble);
+		__m256i high = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble);
+		__m256i result = _mm256_setzero_si256();
+
+		for (int j = 0; j < 16; j++) {
+			__m256i row = _mm256_cmpeq_epi8(high, _mm256_set1_epi8(static_cast<char>(j)));
+			result = _mm256_or_si256(result, _mm256_and_si256(row, _mm256_shuffle_epi8(rows[j], low)));
+		}
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(text + i), result);
+	}
+
+	TransformScalar(text, i, textLength, table);
+}
+
+LUPUS_TARGET_AVX2 static int CompareCharsAVX2(const char* lhs, const char* rhs, int length, bool insensitive)
+{
+	// variables
+	int i = 0;
+
+	// 32 bytes per step, the first differing byte is compared by the scalar loop
+	for (; i + 32 <= length; i += 32) {
+		__m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+		__m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+
+		if (insensitive) {
+			left = FlipCaseAVX2(left, 'A');
+			right = FlipCaseAVX2(right, 'A');
+		}
+
+		unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)));
+
+		if (mask) {
+			return CompareCharsScalar(lhs, rhs, i + FirstBit(mask), length, insensitive);
+		}
+	}
+
+	return CompareCharsScalar(lhs, rhs, i, length, insensitive);
+}
+
+LUPUS_TARGET_AVX2 static int FindCharAVX2(const char* text, int textLength, const char* cases)
+{
+	// variables
+	__m256i lower = _mm256_set1_epi8(cases[0]);
+	__m256i upper = _mm256_set1_epi8(cases[1]);
+	int i = 0;
+
+	// 32 bytes per step
+	for (; i + 32 <= textLength; i += 32) {
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, lower), _mm256_cmpeq_epi8(block, upper))));
+
+		if (mask) {
+			return (i + FirstBit(mask));
+		}
+	}
+
+	return FindCharScalar(text, i, textLength, cases);
+}
+
+LUPUS_TARGET_AVX2 static int FindLastCharAVX2(const char* text, int textLength, const char* cases)
+{
+	// variables
+	__m256i lower = _mm256_set1_epi8(cases[0]);
+	__m256i upper = _mm256_set1_epi8(cases[1]);
+	int i = textLength;
+
+	// 32 bytes per step from the end
+	for (; i >= 32; i -= 32) {
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i - 32));
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, lower), _mm256_cmpeq_epi8(block, upper))));
+
+		if (mask) {
+			return (i - 32 + LastBit(mask));
+		}
+	}
+
+	return FindLastCharScalar(text, i, cases);
+}
+
+LUPUS_TARGET_AVX2 static int CountCharAVX2(const char* text, int textLength, char ch)
+{
+	// variables
+	__m256i needle = _mm256_set1_epi8(ch);
+	__m256i zero = _mm256_setzero_si256();
+	__m256i total = zero;
+	int i = 0;
+
+	// matches subtract -1 from byte counters, which are summed up before they can overflow
+	while (i + 32 <= textLength) {
+		__m256i counts = zero;
+
+		for (int blocks = 0; blocks < 255 && i + 32 <= textLength; blocks++, i += 32) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+			counts = _mm256_sub_epi8(counts, _mm256_cmpeq_epi8(block, needle));
+		}
+
+		total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, zero));
+	}
+
+	__m128i sum = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+	return _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8)) + CountCharScalar(text, i, textLength, ch);
+}
+
+LUPUS_TARGET_AVX2 static int FindStringAVX2(const char* text, int textLength, const Pattern& pattern)
+{
+	// variables
+	__m256i firstLower = _mm256_set1_epi8(pattern.first[0]);
+	__m256i firstUpper = _mm256_set1_epi8(pattern.first[1]);
+	__m256i lastLower = _mm256_set1_epi8(pattern.last[0]);
+	__m256i lastUpper = _mm256_set1_epi8(pattern.last[1]);
+	int last = pattern.length - 1;
+	int i = 0;
+
+	// test 32 candidate positions per step
+	for (; i + last + 32 <= textLength; i += 32) {
+		__m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+		__m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + last));
+		__m256i matchFirst = _mm256_or_si256(_mm256_cmpeq_epi8(blockFirst, firstLower), _mm256_cmpeq_epi8(blockFirst, firstUpper));
+		__m256i matchLast = _mm256_or_si256(_mm256_cmpeq_epi8(blockLast, lastLower), _mm256_cmpeq_epi8(blockLast, lastUpper));
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(matchFirst, matchLast)));
+
+		while (mask) {
+			int index = i + FirstBit(mask);
+
+			if (Verify(text + index, pattern)) {
+				return index;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	return FindStringScalar(text, i, textLength, pattern);
+}
+
+LUPUS_TARGET_AVX2 static int FindLastStringAVX2(const char* text, int textLength, const Pattern& pattern)
+{
+	// variables
+	__m256i firstLower = _mm256_set1_epi8(pattern.first[0]);
+	__m256i firstUpper = _mm256_set1_epi8(pattern.first[1]);
+	__m256i lastLower = _mm256_set1_epi8(pattern.last[0]);
+	__m256i lastUpper = _mm256_set1_epi8(pattern.last[1]);
+	int last = pattern.length - 1;
+	int i = textLength - last;
+
+	// test 32 candidate positions per step from the end
+	for (; i >= 32; i -= 32) {
+		__m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i - 32));
+		__m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i - 32 + last));
+		__m256i matchFirst = _mm256_or_si256(_mm256_cmpeq_epi8(blockFirst, firstLower), _mm256_cmpeq_epi8(blockFirst, firstUpper));
+		__m256i matchLast = _mm256_or_si256(_mm256_cmpeq_epi8(blockLast, lastLower), _mm256_cmpeq_epi8(blockLast, lastUpper));
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(matchFirst, matchLast)));
+
+		while (mask) {
+			int bit = LastBit(mask);
+
+			if (Verify(text + i - 32 + bit, pattern)) {
+				return (i - 32 + bit);
+			}
+
+			mask &= ~(1u << bit);
+		}
+	}
+
+	return FindLastStringScalar(text, i, pattern);
+}
+
+LUPUS_TARGET_AVX2 static unsigned int MatchNibblesAVX2(__m256i block, __m256i low, __m256i high)
+{
+	// variables
+	__m256i nibble = _mm256_set1_epi8(0x0f);
+	__m256i lowBits = _mm256_shuffle_epi8(low, _mm256_and_si256(block, nibble));
+	__m256i highBits = _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble));
+	__m256i miss = _mm256_cmpeq_epi8(_mm256_and_si256(lowBits, highBits), _mm256_setzero_si256());
+
+	return ~static_cast<unsigned int>(_mm256_movemask_epi8(miss));
+}
+
+LUPUS_TARGET_AVX2 static int FindAnyCharAVX2(const char* text, int textLength, const Lupus::System::CharSet& set)
+{
+	// variables
+	char lowTable[32];
+	char highTable[32];
+	int i = 0;
+
+	// prepare lookup tables for both lanes
+	BuildNibbleTables(set, lowTable, highTable);
+
+	__m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lowTable));
+	__m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(highTable));
+
+	// 32 bytes per step
+	for (; i + 32 <= textLength; i += 32) {
+		unsigned int mask = MatchNibblesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i)), low, high);
+
+		if (mask) {
+			return (i + FirstBit(mask));
+		}
+	}
+
+	return FindAnyCharScalar(text, i, textLength, set);
+}
+
+LUPUS_TARGET_AVX2 static int FindLastAnyCharAVX2(const char* text, int textLength, const Lupus::System::CharSet& set)
+{
+	// variables
+	char lowTable[32];
+	char highTable[32];
+	int i = textLength;
+
+	// prepare lookup tables for both lanes
+	BuildNibbleTables(set, lowTable, highTable);
+
+	__m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lowTable));
+	__m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(highTable));
+
+	// 32 bytes per step from the end
+	for (; i >= 32; i -= 32) {
+		unsigned int mask = MatchNibblesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i - 32)), low, high);
+
+		if (mask) {
+			return (i - 32 + LastBit(mask));
+		}
+	}
+
+	return FindLastAnyCharScalar(text, i, set);
+}
+
+static int FindInvalidUtf8SSE2(const unsigned char* text, int textLength)
+{
+	// variables
+	int i = 0;
+
+	// skip ascii blocks, check sequences of other blocks one at a time
+	while (i + 16 <= textLength) {
+		if (!_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i)))) {
+			i += 16;
+			continue;
+		}
+
+		for (int end = i + 16; i < end;) {
+			int length = Utf8SequenceLength(text, i, textLength);
+
+			if (!length) {
+				return i;
+			}
+
+			i += length;
+		}
+	}
+
+	return FindInvalidUtf8Scalar(text, i, textLength);
+}
+
+//! error bits of the utf-8 lookup tables, each describes an invalid pair of bytes
+static const char sTooShort = 1 << 0;
+static const char sTooLong = 1 << 1;
+static const char sOverlong3 = 1 << 2;
+static const char sTooLarge = 1 << 3;
+static const char sSurrogate = 1 << 4;
+static const char sOverlong2 = 1 << 5;
+static const char sTooLarge1000 = 1 << 6;
+static const char sOverlong4 = 1 << 6;
+static const char sTwoContinuations = static_cast<char>(1 << 7);
+static const char sCarry = sTooShort | sTooLong | sTwoContinuations;
+
+LUPUS_TARGET_AVX2 static __m256i Utf8ErrorsAVX2(__m256i block, __m256i previous)
+{
+	// lookup tables for high and low nibble of the previous byte and high nibble of the current byte
+	__m256i previousHigh = _mm256_setr_epi8(
+		sTooLong, sTooLong, sTooLong, sTooLong, sTooLong, sTooLong, sTooLong, sTooLong,
+		sTwoContinuations, sTwoContinuations, sTwoContinuations, sTwoContinuations,
+		sTooShort | sOverlong2, sTooShort, sTooShort | sOverlong3 | sSurrogate, sTooShort | sTooLarge | sTooLarge1000 | sOverlong4,
+		sTooLong, sTooLong, sTooLong, sTooLong, sTooLong, sTooLong, sTooLong, sTooLong,
+		sTwoContinuations, sTwoContinuations, sTwoContinuations, sTwoContinuations,
+		sTooShort | sOverlong2, sTooShort, sTooShort | sOverlong3 | sSurrogate, sTooShort | sTooLarge | sTooLarge1000 | sOverlong4);
+	__m256i previousLow = _mm256_setr_epi8(
+		sCarry | sOverlong3 | sOverlong2 | sOverlong4, sCarry | sOverlong2, sCarry, sCarry,
+		sCarry | sTooLarge, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000,
+		sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000,
+		sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000 | sSurrogate, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000,
+		sCarry | sOverlong3 | sOverlong2 | sOverlong4, sCarry | sOverlong2, sCarry, sCarry,
+		sCarry | sTooLarge, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000,
+		sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000,
+		sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000 | sSurrogate, sCarry | sTooLarge | sTooLarge1000, sCarry | sTooLarge | sTooLarge1000);
+	__m256i currentHigh = _mm256_setr_epi8(
+		sTooShort, sTooShort, sTooShort, sTooShort, sTooShort, sTooShort, sTooShort, sTooShort,
+		sTooLong | sOverlong2 | sTwoContinuations | sOverlong3 | sTooLarge1000 | sOverlong4,
+		sTooLong | sOverlong2 | sTwoContinuations | sOverlong3 | sTooLarge,
+		sTooLong | sOverlong2 | sTwoContinuations | sSurrogate | sTooLarge,
+		sTooLong | sOverlong2 | sTwoContinuations | sSurrogate | sTooLarge,
+		sTooShort, sTooShort, sTooShort, sTooShort,
+		sTooShort, sTooShort, sTooShort, sTooShort, sTooShort, sTooShort, sTooShort, sTooShort,
+		sTooLong | sOverlong2 | sTwoContinuations | sOverlong3 | sTooLarge1000 | sOverlong4,
+		sTooLong | sOverlong2 | sTwoContinuations | sOverlong3 | sTooLarge,
+		sTooLong | sOverlong2 | sTwoContinuations | sSurrogate | sTooLarge,
+		sTooLong | sOverlong2 | sTwoContinuations | sSurrogate | sTooLarge,
+		sTooShort, sTooShort, sTooShort, sTooShort);
+	__m256i nibble = _mm256_set1_epi8(0x0f);
+
+	// the three bytes preceding every byte, crossing into the previous block
+	__m256i carried = _mm256_permute2x128_si256(previous, block, 0x21);
+	__m256i previous1 = _mm256_alignr_epi8(block, carried, 15);
+	__m256i previous2 = _mm256_alignr_epi8(block, carried, 14);
+	__m256i previous3 = _mm256_alignr_epi8(block, carried, 13);
+
+	// invalid pairs of bytes are flagged by all three lookups
+	__m256i special = _mm256_and_si256(
+		_mm256_and_si256(
+			_mm256_shuffle_epi8(previousHigh, _mm256_and_si256(_mm256_srli_epi16(previous1, 4), nibble)),
+			_mm256_shuffle_epi8(previousLow, _mm256_and_si256(previous1, nibble))),
+		_mm256_shuffle_epi8(currentHigh, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble)));
+
+	// third and fourth bytes have to be continuations, which the pair lookup flags as two continuations
+	__m256i third = _mm256_subs_epu8(previous2, _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+	__m256i fourth = _mm256_subs_epu8(previous3, _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+	__m256i required = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+
+	return _mm256_xor_si256(required, special);
+}
+
+LUPUS_TARGET_AVX2 static __m256i Utf8IncompleteAVX2(__m256i block)
+{
+	// lead bytes within the last three bytes whose sequence continues in the next block
+	__m256i limit = _mm256_setr_epi8(
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		static_cast<char>(0xf0 - 1), static_cast<char>(0xe0 - 1), static_cast<char>(0xc0 - 1));
+
+	return _mm256_subs_epu8(block, limit);
+}
+
+LUPUS_TARGET_AVX2 static bool IsValidUtf8AVX2(const unsigned char* text, int textLength)
+{
+	// variables
+	__m256i errors = _mm256_setzero_si256();
+	__m256i previous = _mm256_setzero_si256();
+	__m256i incomplete = _mm256_setzero_si256();
+	unsigned char last[32] = { 0 };
+	int i = 0;
+
+	// check 32 bytes per step, ascii blocks only complete the previous block
+	for (; i + 32 <= textLength; i += 32) {
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+
+		if (!_mm256_movemask_epi8(block)) {
+			errors = _mm256_or_si256(errors, incomplete);
+		} else {
+			errors = _mm256_or_si256(errors, Utf8ErrorsAVX2(block, previous));
+			incomplete = Utf8IncompleteAVX2(block);
+		}
+
+		previous = block;
+	}
+
+	// remaining bytes padded with ascii zeros
+	if (i < textLength) {
+		memcpy(last, text + i, textLength - i);
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last));
+		errors = _mm256_or_si256(errors, Utf8ErrorsAVX2(block, previous));
+		incomplete = Utf8IncompleteAVX2(block);
+	}
+
+	errors = _mm256_or_si256(errors, incomplete);
+	return (_mm256_testz_si256(errors, errors) != 0);
+}
+#endif
+
+static Lupus::System::SimdLevel DetectSimdLevel()
+{
+#ifdef LUPUS_SIMD_X86
+	// variables
+	int info[4] = { 0 };
+	int features[4] = { 0 };
+
+	Cpuid(info, 0, 0);
+	int maxLeaf = info[0];
+	Cpuid(features, 1, 0);
+
+	// avx2 needs cpu support and operating system support for ymm registers
+	if (maxLeaf >= 7 && (features[2] & (1 << 27)) && (features[2] & (1 << 28)) && ((XGetBv() & 0x6) == 0x6)) {
+		Cpuid(info, 7, 0);
+
+		if (info[1] & (1 << 5)) {
+			return Lupus::System::SimdLevel::AVX2;
+		}
+	}
+
+	// byte shuffles
+	if (features[2] & (1 << 9)) {
+		return Lupus::System::SimdLevel::SSSE3;
+	}
+
+	return Lupus::System::SimdLevel::SSE2;
+#else
+	return Lupus::System::SimdLevel::None;
+#endif
+}
+
+//! zero initialized until detected, scans use scalar loops meanwhile
+static const Lupus::System::SimdLevel sSimdLevel = DetectSimdLevel();
+
+namespace Lupus {
+	namespace System {
+		SimdLevel GetSimdLevel()
+		{
+			return sSimdLevel;
+		}
+
+		int FindChar(const char* text, int textLength, char ch, CaseSensitivity sensitivity)
+		{
+			// variables
+			char cases[2];
+
+			// compute result
+			GetCases(ch, sensitivity, cases);
+
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				return FindCharAVX2(text, textLength, cases);
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				return FindCharSSE2(text, textLength, cases);
+#endif
+			default:
+				return FindCharScalar(text, 0, textLength, cases);
+			}
+		}
+
+		int FindLastChar(const char* text, int textLength, char ch, CaseSensitivity sensitivity)
+		{
+			// variables
+			char cases[2];
+
+			// compute result
+			GetCases(ch, sensitivity, cases);
+
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				return FindLastCharAVX2(text, textLength, cases);
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				return FindLastCharSSE2(text, textLength, cases);
+#endif
+			default:
+				return FindLastCharScalar(text, textLength, cases);
+			}
+		}
+
+		int CountChar(const char* text, int textLength, char ch)
+		{
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				return CountCharAVX2(text, textLength, ch);
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				return CountCharSSE2(text, textLength, ch);
+#endif
+			default:
+				return CountCharScalar(text, 0, textLength, ch);
+			}
+		}
+
+		int FindAnyChar(const char* text, int textLength, const CharSet& set)
+		{
+#ifdef LUPUS_SIMD_X86
+			// shuffle lookup covers ascii chars only
+			if (set.IsAscii()) {
+				switch (sSimdLevel) {
+				case SimdLevel::AVX2:
+					return FindAnyCharAVX2(text, textLength, set);
+				case SimdLevel::SSSE3:
+					return FindAnyCharSSSE3(text, textLength, set);
+				default:
+					break;
+				}
+			}
+#endif
+
+			return FindAnyCharScalar(text, 0, textLength, set);
+		}
+
+		int FindLastAnyChar(const char* text, int textLength, const CharSet& set)
+		{
+#ifdef LUPUS_SIMD_X86
+			// shuffle lookup covers ascii chars only
+			if (set.IsAscii()) {
+				switch (sSimdLevel) {
+				case SimdLevel::AVX2:
+					return FindLastAnyCharAVX2(text, textLength, set);
+				case SimdLevel::SSSE3:
+					return FindLastAnyCharSSSE3(text, textLength, set);
+				default:
+					break;
+				}
+			}
+#endif
+
+			return FindLastAnyCharScalar(text, textLength, set);
+		}
+
+		int CompareChars(const char* lhs, const char* rhs, int length, CaseSensitivity sensitivity)
+		{
+			// variables
+			bool insensitive = (sensitivity == CaseSensitivity::CaseInsensitive);
+
+			// compute result
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				return CompareCharsAVX2(lhs, rhs, length, insensitive);
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				return CompareCharsSSE2(lhs, rhs, length, insensitive);
+#endif
+			default:
+				return CompareCharsScalar(lhs, rhs, 0, length, insensitive);
+			}
+		}
+
+		void ToLowerChars(char* text, int textLength)
+		{
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				ConvertCaseAVX2(text, textLength, false);
+				break;
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				ConvertCaseSSE2(text, textLength, false);
+				break;
+#endif
+			default:
+				ConvertCaseScalar(text, 0, textLength, textLength, false);
+				break;
+			}
+		}
+
+		void ToUpperChars(char* text, int textLength)
+		{
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				ConvertCaseAVX2(text, textLength, true);
+				break;
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				ConvertCaseSSE2(text, textLength, true);
+				break;
+#endif
+			default:
+				ConvertCaseScalar(text, 0, textLength, textLength, true);
+				break;
+			}
+		}
+
+		void TransformChars(char* text, int textLength, const ubyte* table)
+		{
+#ifdef LUPUS_SIMD_X86
+			// table lookup by byte shuffles is implemented for avx2 only
+			if (sSimdLevel == SimdLevel::AVX2) {
+				TransformAVX2(text, textLength, table);
+				return;
+			}
+#endif
+
+			TransformScalar(text, 0, textLength, table);
+		}
+
+		int FindInvalidUtf8(const char* text, int textLength)
+		{
+			// variables
+			const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text);
+
+			// compute result
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				// valid input is the common case, locate errors only if there are some
+				return IsValidUtf8AVX2(bytes, textLength) ? -1 : FindInvalidUtf8Scalar(bytes, 0, textLength);
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				return FindInvalidUtf8SSE2(bytes, textLength);
+#endif
+			default:
+				return FindInvalidUtf8Scalar(bytes, 0, textLength);
+			}
+		}
+
+		int CompareCharsLocale(const char* lhs, const char* rhs, int length)
+		{
+			for (int i = 0; i < length; i++) {
+				int lch = tolower(static_cast<unsigned char>(lhs[i]));
+				int rch = tolower(static_cast<unsigned char>(rhs[i]));
+
+				if (lch != rch) {
+					return (lch - rch);
+				}
+			}
+
+			return 0;
+		}
+
+		int FindString(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity)
+		{
+			// check arguments
+			if (searchLength <= 0) {
+				return 0;
+			} else if (searchLength > textLength) {
+				return -1;
+			} else if (searchLength == 1) {
+				return FindChar(text, textLength, search[0], sensitivity);
+			}
+
+			// variables
+			Pattern pattern;
+
+			// prepare pattern
+			pattern.data = search;
+			pattern.length = searchLength;
+			pattern.insensitive = (sensitivity == CaseSensitivity::CaseInsensitive);
+			GetCases(search[0], sensitivity, pattern.first);
+			GetCases(search[searchLength - 1], sensitivity, pattern.last);
+
+			// compute result
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				return FindStringAVX2(text, textLength, pattern);
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				return FindStringSSE2(text, textLength, pattern);
+#endif
+			default:
+				return FindStringScalar(text, 0, textLength, pattern);
+			}
+		}
+
+		int FindLastString(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity)
+		{
+			// check arguments
+			if (searchLength <= 0) {
+				return textLength;
+			} else if (searchLength > textLength) {
+				return -1;
+			} else if (searchLength == 1) {
+				return FindLastChar(text, textLength, search[0], sensitivity);
+			}
+
+			// variables
+			Pattern pattern;
+
+			// prepare pattern
+			pattern.data = search;
+			pattern.length = searchLength;
+			pattern.insensitive = (sensitivity == CaseSensitivity::CaseInsensitive);
+			GetCases(search[0], sensitivity, pattern.first);
+			GetCases(search[searchLength - 1], sensitivity, pattern.last);
+
+			// compute result
+			switch (sSimdLevel) {
+#ifdef LUPUS_SIMD_X86
+			case SimdLevel::AVX2:
+				return FindLastStringAVX2(text, textLength, pattern);
+			case SimdLevel::SSSE3:
+			case SimdLevel::SSE2:
+				return FindLastStringSSE2(text, textLength, pattern);
+#endif
+			default:
+				return FindLastStringScalar(text, textLength - searchLength + 1, pattern);
+			}
+		}
+
+		template <>
+		bool Vector<char>::Contains(const char& item) const
+		{
+			return (FindChar(_data, _length, item) != -1);
+		}
+	}
+}
@@ -0,0 +1,211 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_SIMD_HPP
+#define LUPUS_SIMD_HPP
+
+#include "Types.hpp"
+
+namespace Lupus {
+	namespace System {
+		// declarations
+		class CharSet;
+
+		//! instruction set extensions used by the vectorized scans
+		enum class SimdLevel {
+			//! plain byte at a time loops
+			None,
+			//! 16 bytes per step
+			SSE2,
+			//! 16 bytes per step, byte shuffles as table lookup
+			SSSE3,
+			//! 32 bytes per step
+			AVX2
+		};
+
+		/**
+		 * returns instruction set used by the vectorized scans
+		 *
+		 * determined once with cpuid, including operating system support for avx registers
+		 */
+		LUPUS_API SimdLevel GetSimdLevel();
+
+		//! ascii lower case of every unsigned char value, maps 'A' to 'Z' onto 'a' to 'z' and keeps every other byte
+		extern LUPUS_API const ubyte AsciiLowerTable[256];
+
+		//! ascii upper case of every unsigned char value, maps 'a' to 'z' onto 'A' to 'Z' and keeps every other byte
+		extern LUPUS_API const ubyte AsciiUpperTable[256];
+
+		/**
+		 * searches first occurrence of a char
+		 *
+		 * @param text text to search through
+		 * @param textLength length of text
+		 * @param ch char to search for
+		 * @param sensitivity case sensitivity of the search
+		 * @return index of first occurrence or -1 if not found
+		 */
+		LUPUS_API int FindChar(const char* text, int textLength, char ch, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+
+		/**
+		 * searches last occurrence of a char
+		 *
+		 * @param text text to search through
+		 * @param textLength length of text
+		 * @param ch char to search for
+		 * @param sensitivity case sensitivity of the search
+		 * @return index of last occurrence or -1 if not found
+		 */
+		LUPUS_API int FindLastChar(const char* text, int textLength, char ch, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+
+		/**
+		 * counts occurrences of a char
+		 *
+		 * matches are accumulated in byte counters for a whole block of text.
+		 *
+		 * @param text text to search through
+		 * @param textLength length of text
+		 * @param ch char to count
+		 * @return number of occurrences
+		 */
+		LUPUS_API int CountChar(const char* text, int textLength, char ch);
+
+		/**
+		 * searches first occurrence of any char of a set
+		 *
+		 * ascii sets are matched with a nibble shuffle lookup for a whole block of text.
+		 *
+		 * @param text text to search through
+		 * @param textLength length of text
+		 * @param set chars to search for
+		 * @return index of first occurrence or -1 if not found
+		 */
+		LUPUS_API int FindAnyChar(const char* text, int textLength, const CharSet& set);
+
+		/**
+		 * searches last occurrence of any char of a set
+		 *
+		 * @param text text to search through
+		 * @param textLength length of text
+		 * @param set chars to search for
+		 * @return index of last occurrence or -1 if not found
+		 */
+		LUPUS_API int FindLastAnyChar(const char* text, int textLength, const CharSet& set);
+
+		/**
+		 * compares two char ranges of equal length
+		 *
+		 * whole blocks are compared at once, only the first differing block is compared
+		 * byte by byte. case insensitive comparison folds ascii letters only and doesn't
+		 * depend on the current locale.
+		 *
+		 * @param lhs first char range
+		 * @param rhs second char range
+		 * @param length number of chars to compare
+		 * @param sensitivity case sensitivity of the comparison
+		 * @return zero if equal, else the difference of the first differing unsigned (folded) chars
+		 */
+		LUPUS_API int CompareChars(const char* lhs, const char* rhs, int length, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+
+		/**
+		 * compares two char ranges of equal length case insensitive with the current locale
+		 *
+		 * @param lhs first char range
+		 * @param rhs second char range
+		 * @param length number of chars to compare
+		 * @return zero if equal, else the difference of the first differing chars converted by tolower
+		 */
+		LUPUS_API int CompareCharsLocale(const char* lhs, const char* rhs, int length);
+
+		/**
+		 * converts chars to lower case in place
+		 *
+		 * ascii letters are converted a whole block at a time. blocks with non ascii bytes are
+		 * converted byte by byte, where utf-8 encoded latin-1 letters are converted as well.
+		 *
+		 * @param text text to convert
+		 * @param textLength length of text
+		 */
+		LUPUS_API void ToLowerChars(char* text, int textLength);
+
+		/**
+		 * converts chars to upper case in place
+		 *
+		 * \sa ToLowerChars
+		 *
+		 * @param text text to convert
+		 * @param textLength length of text
+		 */
+		LUPUS_API void ToUpperChars(char* text, int textLength);
+
+		/**
+		 * replaces every char by its entry within a table in place
+		 *
+		 * uses byte shuffles as table lookup with avx2, a byte at a time otherwise.
+		 *
+		 * @param text text to convert
+		 * @param textLength length of text
+		 * @param table replacement for every unsigned char value, 256 entries
+		 */
+		LUPUS_API void TransformChars(char* text, int textLength, const ubyte* table);
+
+		/**
+		 * searches first byte which doesn't start a valid utf-8 sequence
+		 *
+		 * rejects truncated sequences, overlong encodings, surrogates and code points above
+		 * 0x10ffff. ascii blocks are skipped a whole block at a time. with avx2 every block is
+		 * checked by three nibble lookups on byte pairs, which needs no branch per sequence.
+		 *
+		 * @param text text to check
+		 * @param textLength length of text
+		 * @return index of first invalid sequence or -1 if text is valid utf-8
+		 */
+		LUPUS_API int FindInvalidUtf8(const char* text, int textLength);
+
+		/**
+		 * searches first occurrence of a string
+		 *
+		 * candidates are filtered by comparing first and last pattern char
+		 * against a whole block of text and are verified afterwards.
+		 *
+		 * @param text text to search through
+		 * @param textLength length of text
+		 * @param search pattern to search for
+		 * @param searchLength length of pattern
+		 * @param sensitivity case sensitivity of the search
+		 * @return index of first occurrence or -1 if not found
+		 */
+		LUPUS_API int FindString(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+
+		/**
+		 * searches last occurrence of a string
+		 *
+		 * same candidate filter as FindString, but blocks are tested from the end.
+		 *
+		 * @param text text to search through
+		 * @param textLength length of text
+		 * @param search pattern to search for
+		 * @param searchLength length of pattern
+		 * @param sensitivity case sensitivity of the search
+		 * @return index of last occurrence, textLength for an empty pattern or -1 if not found
+		 */
+		LUPUS_API int FindLastString(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+	}
+}
+
+#endif
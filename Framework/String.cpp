@@ -17,29 +17,42 @@
  */
 
 #include "String.hpp"
+#include "StringView.hpp"
 #include "Vector.hpp"
 #include "Exception.hpp"
+#include "Simd.hpp"
+#include "AhoCorasick.hpp"
+#include "CharSet.hpp"
+#include "StringSplitter.hpp"
+#include "Hash.hpp"
+#include "Encoding.hpp"
 #include <cstring>
+#include <cwchar>
 #include <cctype>
+#include <utility>
 
 namespace Lupus {
 	namespace System {
 		Pointer<ITextSearchStrategy> String::_defaultStrategy = new KnuthMorrisPratt();
-		PropertyWriter<Pointer<ITextSearchStrategy>> String::DefaultTextSearchAlgorithm = 
-			PropertyWriter<Pointer<ITextSearchStrategy>>(String::_defaultStrategy);
 
 		String::String() :
-			_data(new char[DEFAULT_ARRAY_SIZE]),
+			_data(_buffer),
 			_length(0),
 			_capacity(DEFAULT_ARRAY_SIZE - 1),
-			_strategy(_defaultStrategy->Copy())
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
 		{
-			memset(_data, 0, DEFAULT_ARRAY_SIZE);
+			_buffer[0] = 0;
 		}
 
 		String::String(const char* source) :
-			_data(nullptr),
-			_strategy(_defaultStrategy->Copy())
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
 		{
 			// check argument
 			if (!source) {
@@ -50,15 +63,37 @@ namespace Lupus {
 			int length = strlen(source);
 
 			// code
-			_data = new char[length + 1];
-			strncpy(_data, source, length);
+			Allocate(length);
+			memcpy(_data, source, length);
+			_data[length] = 0;
+			_length = length;
+		}
+
+		String::String(const StringView& view) :
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
+		{
+			// variables
+			int length = view.Length();
+
+			// code
+			Allocate(length);
+			memcpy(_data, view.Data(), length);
 			_data[length] = 0;
-			_length = _capacity = length;
+			_length = length;
 		}
 
 		String::String(const char* source, int startIndex, int length) :
-			_data(nullptr),
-			_strategy(_defaultStrategy->Copy())
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
 		{
 			// check source string
 			if (!source) {
@@ -70,14 +105,19 @@ namespace Lupus {
 			}
 
 			// code
-			_data = new char[length + 1];
-			strncpy(_data, source + startIndex, length);
+			Allocate(length);
+			memcpy(_data, source + startIndex, length);
 			_data[length] = 0;
-			_length = _capacity = length;
+			_length = length;
 		}
 
 		String::String(const Char* source) :
-			_strategy(_defaultStrategy->Copy())
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
 		{
 			// check argument
 			if (!source) {
@@ -89,12 +129,12 @@ namespace Lupus {
 
 			// in case the string is empty, apply it now
 			if (!length) {
-				*this = String();
+				_buffer[0] = 0;
 				return;
 			}
 
 			// set values
-			_data = new char[length + 1];
+			Allocate(length);
 
 			// set internal buffer
 			for (int i = 0; i < length; i++) {
@@ -102,11 +142,16 @@ namespace Lupus {
 			}
 
 			_data[length] = 0;
-			_length = _capacity = length;
+			_length = length;
 		}
 
 		String::String(const Char* source, int startIndex, int count) :
-			_strategy(_defaultStrategy->Copy())
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
 		{
 			// check arguments
 			if (!source) {
@@ -122,7 +167,7 @@ namespace Lupus {
 
 			// in case the string is empty, apply it now
 			if (!sourceLength) {
-				*this = String();
+				_buffer[0] = 0;
 				return;
 			}
 
@@ -132,41 +177,104 @@ namespace Lupus {
 			}
 
 			// create buffer
-			_data = new char[count + 1];
+			Allocate(count);
 
 			// set internal buffer
 			for (int i = 0; i < count; i++) {
 				_data[i] = source[i + startIndex].Value;
 			}
 
-			// terminate with zero and free not needed memory
+			// terminate with zero
 			_data[count] = 0;
-			_length = _capacity = count;
+			_length = count;
 		}
 
 		String::String(const String& string) :
-			_data(new char[string.Length + 1]),
-			_length(string.Length),
-			_capacity(string.Length),
-			_strategy(_defaultStrategy->Copy())
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(string._hashCode.load(std::memory_order_relaxed)),
+			_writable(false)
 		{
-			strncpy(_data, string.Data, _length);
-			_data[_length] = 0;
+			Allocate(string._length);
+			memcpy(_data, string._data, string._length);
+			_data[string._length] = 0;
+			_length = string._length;
 		}
 
 		String::String(String&& string) :
 			String()
 		{
-			Lupus::Swap(_data, string._data);
-			Lupus::Swap(_length, string._length);
-			Lupus::Swap(_capacity, string._capacity);
+			operator=(std::move(string));
 		}
 
-		String::~String()
+		//! wchar_t holds utf-16 on windows and utf-32 on unix
+		static int WideToUtf8(const wchar_t* source, int length, char* target)
 		{
-			if (_data) {
-				delete[] _data;
+			if (sizeof(wchar_t) == sizeof(ushort)) {
+				return Utf16ToUtf8(reinterpret_cast<const ushort*>(source), length, target);
+			} else {
+				return Utf32ToUtf8(reinterpret_cast<const uint*>(source), length, target);
+			}
+		}
+
+		String::String(const wchar_t* source) :
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
+		{
+			// check argument
+			if (!source) {
+				throw ArgumentNullException("source string must have a valid value");
 			}
+
+			// variables
+			int length = static_cast<int>(wcslen(source));
+			int size = WideToUtf8(source, length, nullptr);
+
+			// code
+			Allocate(size);
+			WideToUtf8(source, length, _data);
+			_data[size] = 0;
+			_length = size;
+		}
+
+		String::String(const wchar_t* source, int startIndex, int length) :
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
+		{
+			// check source string
+			if (!source) {
+				throw ArgumentNullException("source string must have a valid value");
+			} else if (startIndex < 0) {
+				throw ArgumentOutOfRangeException("startIndex must be greater than or equal to zero");
+			} else if (length <= 0) {
+				throw ArgumentOutOfRangeException("length must be greater than zero");
+			} else if ((startIndex + length) > static_cast<int>(wcslen(source))) {
+				throw ArgumentOutOfRangeException("startIndex plus length exceeds source length");
+			}
+
+			// variables
+			int size = WideToUtf8(source + startIndex, length, nullptr);
+
+			// code
+			Allocate(size);
+			WideToUtf8(source + startIndex, length, _data);
+			_data[size] = 0;
+			_length = size;
+		}
+
+		String::~String()
+		{
+			Deallocate();
 		}
 
 		String& String::Append(const String& string)
@@ -179,49 +287,111 @@ namespace Lupus {
 			return operator+=(ch);
 		}
 
-		int String::Compare(const String& string, CaseSensitivity sensitivity) const
+		String& String::Append(const char* str)
 		{
-			// check length
-			if (_length != string.Length) {
-				return (_length - string.Length);
+			return operator+=(str);
+		}
+
+		String& String::Append(const char* str, int count)
+		{
+			// check arguments
+			if (!str) {
+				throw ArgumentNullException("source string must have a valid value");
+			} else if (count < 0) {
+				throw ArgumentOutOfRangeException("count must be greater than or equal to zero");
 			}
 
-			// variables
-			const char* data = string.Data;
+			// check if capacity is big enough
+			if ((_capacity - _length) < count) {
+				// source might point into this instance
+				bool inside = (str >= _data && str < (_data + _length));
+				int offset = static_cast<int>(str - _data);
 
-			// compute result
-			switch (sensitivity) {
-			case CaseSensitivity::CaseSensitive:
-				for (int i = 0; i < _length; i++) {
-					if (_data[i] != data[i]) {
-						return (_data[i] - data[i]);
-					}
-				}
-				break;
-			case CaseSensitivity::CaseInsensitive:
-				for (int i = 0; i < _length; i++) {
-					if (tolower(_data[i]) != tolower(data[i])) {
-						return (_data[i] - data[i]);
-					}
+				Grow(_length + count);
+
+				if (inside) {
+					str = _data + offset;
 				}
-				break;
 			}
 
-			return 0;
+			// append
+			memmove(_data + _length, str, count);
+			_length += count;
+			_data[_length] = 0;
+			ResetHashCode();
+
+			return (*this);
 		}
 
-		bool String::Contains(const String& string, CaseSensitivity sensitivity) const
+		int String::Compare(const StringView& string, CaseSensitivity sensitivity) const
+		{
+			return StringView(*this).Compare(string, sensitivity);
+		}
+
+		int String::CompareLocale(const StringView& string) const
+		{
+			return StringView(*this).CompareLocale(string);
+		}
+
+		ulong String::GetHashCode() const
+		{
+			// content may change through a reference from operator[] without notice
+			if (_writable) {
+				return GetHashCode(CaseSensitivity::CaseSensitive);
+			}
+
+			// variables
+			ulong result = _hashCode.load(std::memory_order_relaxed);
+
+			// compute hash code once, concurrent callers store the same value
+			if (!result) {
+				result = GetHashCode(CaseSensitivity::CaseSensitive);
+				_hashCode.store(result, std::memory_order_relaxed);
+			}
+
+			return result;
+		}
+
+		ulong String::GetHashCode(CaseSensitivity sensitivity) const
+		{
+			return StringView(*this).GetHashCode(sensitivity);
+		}
+
+		Pointer<CompiledPattern> String::Compile(const String& pattern, CaseSensitivity sensitivity)
+		{
+			return _defaultStrategy->Compile(pattern, sensitivity);
+		}
+
+		void String::SetDefaultTextSearchAlgorithm(Pointer<ITextSearchStrategy>&& strategy)
+		{
+			// variables
+			ITextSearchStrategy* algorithm = strategy.Release();
+
+			// check argument
+			if (!algorithm) {
+				throw ArgumentNullException("default text search algorithm must have a valid value");
+			}
+
+			_defaultStrategy = algorithm;
+		}
+
+		bool String::Contains(const StringView& string, CaseSensitivity sensitivity) const
 		{
 			// check arguments
-			if (string == "") {
+			if (string.IsEmpty()) {
 				return true;
-			} else if (_length < string.Length) {
+			} else if (_length < string.Length()) {
 				return false;
-			} else if (_length == string.Length) {
+			} else if (_length == string.Length()) {
 				return (Compare(string, sensitivity) == 0);
 			}
 
-			return (_strategy->Search(_data, _length, string._data, string._length, sensitivity) != -1);
+			return (GetTextSearchStrategy()->Search(_data, _length, string.Data(), string.Length(), sensitivity) != -1);
+		}
+
+		bool String::Contains(const CompiledPattern& pattern) const
+		{
+			return (pattern.Search(_data, _length) != -1);
 		}
 
 		void String::CopyTo(String& string, int startIndex) const
@@ -246,6 +416,7 @@ namespace Lupus {
 
 			// copy values
 			strncpy(string._data + destinationIndex, _data + sourceIndex, count);
+			string.ResetHashCode();
 		}
 
 		int String::IndexOf(const Char& ch, int startIndex, CaseSensitivity sensitivity) const
@@ -257,31 +428,13 @@ namespace Lupus {
 				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
 			}
 
-			// variables
-			Char lower = ch.ToLower();
-
 			// comput result
-			switch (sensitivity) {
-			case CaseSensitivity::CaseSensitive:
-				for (int i = startIndex; i < _length; i++) {
-					if (_data[i] == ch) {
-						return i;
-					}
-				}
-				break;
-			case CaseSensitivity::CaseInsensitive:
-				for (int i = startIndex; i < _length; i++) {
-					if (tolower(_data[i]) == lower) {
-						return i;
-					}
-				}
-				break;
-			}
+			int result = FindChar(_data + startIndex, _length - startIndex, ch, sensitivity);
 
-			return -1;
+			return (result == -1 ? -1 : (startIndex + result));
 		}
 
-		int String::IndexOf(const String& string, int startIndex, CaseSensitivity sensitivity) const
+		int String::IndexOf(const StringView& string, int startIndex, CaseSensitivity sensitivity) const
 		{
 			// check arguments
 			if (startIndex >= _length) {
@@ -290,86 +443,97 @@ namespace Lupus {
 				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
 			}
 
-			// compute result
-			int result = _strategy->Search(_data + startIndex, _length, string._data, string._length, sensitivity);
+			return Find(string.Data(), string.Length(), startIndex, sensitivity);
+		}
 
-			return (result == -1 ? -1 : (startIndex + result));
+		int String::IndexOf(const CompiledPattern& pattern, int startIndex) const
+		{
+			// check arguments
+			if (startIndex >= _length) {
+				throw ArgumentOutOfRangeException("startIndex exceeds string length");
+			} else if (startIndex < 0) {
+				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
+			}
+
+			return Find(pattern, startIndex);
 		}
 
 		int String::IndexOfAny(const ISequence<char>& sequence, int startIndex, CaseSensitivity sensitivity) const
+		{
+			// variables
+			CharSet set(sequence);
+
+			return IndexOfAny((sensitivity == CaseSensitivity::CaseInsensitive) ? set.FoldCase() : set, startIndex);
+		}
+
+		int String::IndexOfAny(const CharSet& set, int startIndex) const
 		{
 			// check arguments
 			if (startIndex >= _length) {
 				throw ArgumentOutOfRangeException("startIndex exceeds string length");
 			} else if (startIndex < 0) {
 				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
-			} else if (sequence.IsEmpty()) {
-				return -1;
 			}
 
 			// comput result
-			switch (sensitivity) {
-			case CaseSensitivity::CaseSensitive:
-				for (int i = startIndex; i < _length; i++) {
-					char& ch = _data[i];
+			int result = FindAnyChar(_data + startIndex, _length - startIndex, set);
 
-					foreach(item, sequence) {
-						if (ch == item->CurrentItem()) {
-							return i;
-						}
-					}
-				}
-				break;
-			case CaseSensitivity::CaseInsensitive:
-				for (int i = startIndex; i < _length; i++) {
-					int ch = tolower(_data[i]);
+			return (result == -1 ? -1 : (startIndex + result));
+		}
 
-					foreach(item, sequence) {
-						if (ch == tolower(item->CurrentItem())) {
-							return i;
-						}
-					}
-				}
-				break;
+		int String::IndexOfAny(const Vector<String>& patterns, int startIndex, CaseSensitivity sensitivity) const
+		{
+			// check arguments
+			if (startIndex >= _length) {
+				throw ArgumentOutOfRangeException("startIndex exceeds string length");
+			} else if (startIndex < 0) {
+				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
+			} else if (patterns.IsEmpty()) {
+				return -1;
 			}
 
-			return -1;
+			return IndexOfAny(AhoCorasick(patterns, sensitivity), startIndex);
 		}
 
-		int String::LastIndexOf(const Char& ch, int startIndex, CaseSensitivity sensitivity) const
+		int String::IndexOfAny(const AhoCorasick& automaton, int startIndex) const
 		{
 			// check arguments
-			if ((_length - startIndex) < 0) {
+			if (startIndex >= _length) {
 				throw ArgumentOutOfRangeException("startIndex exceeds string length");
 			} else if (startIndex < 0) {
 				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
 			}
 
-			// variables
-			Char lower = ch.ToLower();
+			// compute result
+			int result = automaton.Find(_data + startIndex, _length - startIndex).Index;
 
-			// comput result
-			switch (sensitivity) {
-			case CaseSensitivity::CaseSensitive:
-				for (int i = (_length - startIndex); i >= 0; i--) {
-					if (_data[i] == ch) {
-						return i;
-					}
-				}
-				break;
-			case CaseSensitivity::CaseInsensitive:
-				for (int i = (_length - startIndex); i >= 0; i--) {
-					if (tolower(_data[i]) == lower) {
-						return i;
-					}
-				}
-				break;
+			return (result == -1 ? -1 : (startIndex + result));
+		}
+
+		Vector<PatternMatch> String::FindAll(const Vector<String>& patterns, CaseSensitivity sensitivity) const
+		{
+			return FindAll(AhoCorasick(patterns, sensitivity));
+		}
+
+		Vector<PatternMatch> String::FindAll(const AhoCorasick& automaton) const
+		{
+			return automaton.FindAll(_data, _length);
+		}
+
+		int String::LastIndexOf(const Char& ch, int startIndex, CaseSensitivity sensitivity) const
+		{
+			// check arguments
+			if ((_length - startIndex) < 0) {
+				throw ArgumentOutOfRangeException("startIndex exceeds string length");
+			} else if (startIndex < 0) {
+				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
 			}
 
-			return -1;
+			// comput result
+			return FindLastChar(_data, _length - startIndex + 1, ch, sensitivity);
 		}
 
-		int String::LastIndexOf(const String& string, int startIndex, CaseSensitivity sensitivity) const
+		int String::LastIndexOf(const StringView& string, int startIndex, CaseSensitivity sensitivity) const
 		{
 			// check arguments
 			if (startIndex >= _length) {
@@ -378,38 +542,28 @@ namespace Lupus {
 				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
 			}
 
+			// search backward, a match has to end before the last startIndex chars
+			return FindLastString(_data, _length - startIndex, string.Data(), string.Length(), sensitivity);
+		}
+
+		int String::LastIndexOfAny(const ISequence<char>& sequence, int startIndex, CaseSensitivity sensitivity) const
+		{
 			// variables
-			String textString(*this);
-			String searchString(string);
-			int result = -1;
+			CharSet set(sequence);
 
-			// comput result
-			result = _strategy->Search(
-				textString.Reverse().Data + startIndex, 
-				textString._length - startIndex, 
-				searchString.Reverse().Data, 
-				searchString._length, 
-				sensitivity);
-			
-			return (result == -1 ? -1 : (_length - string._length - result - startIndex));
+			return LastIndexOfAny((sensitivity == CaseSensitivity::CaseInsensitive) ? set.FoldCase() : set, startIndex);
 		}
 
-		int String::LastIndexOfAny(const ISequence<char>& sequence, int startIndex, CaseSensitivity sensitivity) const
+		int String::LastIndexOfAny(const CharSet& set, int startIndex) const
 		{
 			// check arguments
 			if (startIndex >= _length) {
-				throw ArgumentNullException("startIndex exceeds string length");
+				throw ArgumentOutOfRangeException("startIndex exceeds string length");
 			} else if (startIndex < 0) {
 				throw ArgumentOutOfRangeException("startIndex must be greater than zero");
-			} else if (sequence.IsEmpty()) {
-				return -1;
 			}
 
-			// variables
-			String string(*this);
-			
-			// compute
-			return (string.Reverse().IndexOfAny(sequence, startIndex, sensitivity));
+			return FindLastAnyChar(_data, _length - startIndex, set);
 		}
 
 		String& String::Remove(int startIndex)
@@ -426,6 +580,7 @@ namespace Lupus {
 
 			// update length
 			_length = startIndex;
+			ResetHashCode();
 
 			return (*this);
 		}
@@ -451,6 +606,7 @@ namespace Lupus {
 
 			// update length
 			_length -= count;
+			ResetHashCode();
 
 			return (*this);
 		}
@@ -472,64 +628,111 @@ namespace Lupus {
 				}
 			}
 
+			ResetHashCode();
+
 			return (*this);
 		}
 
 		String& String::Replace(const String& before, const String& after, CaseSensitivity sensitivity)
+		{
+			return Replace(*GetTextSearchStrategy()->Compile(before, sensitivity), after);
+		}
+
+		String& String::Replace(const CompiledPattern& before, const String& after)
 		{
 			// variables
-			int index = 0;
+			Vector<PatternMatch> matches;
+			int length = before.Length;
 
-			// replace loop
-			while ((index = IndexOf(before, index, sensitivity)) != -1) {
-				for (int i = 0; i < before._length; i++) {
-					RemoveAt(index);
-				}
-				for (int i = 0; i < after._length; i++) {
-					Insert(index + i, after[i]);
-				}
+			// collect non overlapping matches, an empty pattern never matches
+			for (int index = (length > 0) ? Find(before, 0) : -1; index != -1; index = Find(before, index + length)) {
+				PatternMatch match = { index, 0, length };
+				matches.Add(match);
 			}
 
-			return (*this);
+			return ReplaceMatches(matches, &after);
 		}
 
-		String& String::Reverse()
+		String& String::ReplaceAll(const Vector<String>& before, const Vector<String>& after, CaseSensitivity sensitivity)
 		{
+			// check arguments
+			if (before.Count() != after.Count()) {
+				throw ArgumentException("before and after must have the same number of entries");
+			} else if (before.IsEmpty()) {
+				return (*this);
+			}
+
 			// variables
-			char* swap = _data;
-			char* data = new char[_length + 1];
+			AhoCorasick automaton(before, sensitivity);
+			Vector<PatternMatch> matches;
+			int position = 0;
+
+			// collect leftmost longest matches, each search continues behind the previous match
+			while (position < _length) {
+				PatternMatch match = automaton.FindLongest(_data + position, _length - position);
 
-			// reverse string
-			for (int i = (_length - 1), j = 0; i >= 0; i--, j++) {
-				data[j] = _data[i];
+				if (match.Index == -1) {
+					break;
+				}
+
+				match.Index += position;
+				matches.Add(match);
+				position = match.Index + match.Length;
 			}
 
-			_data = data;
-			delete[] swap;
-			_data[_length] = 0;
+			return ReplaceMatches(matches, after.Data);
+		}
+
+		String& String::Reverse()
+		{
+			// reverse string in place
+			for (int i = 0, j = (_length - 1); i < j; i++, j--) {
+				Lupus::Swap(_data[i], _data[j]);
+			}
+
+			ResetHashCode();
 
 			return (*this);
 		}
 
-		void String::ShrinkToFit()
+		void String::Reserve(int capacity)
 		{
-			char* swap = new char[_length + 1];
-			strncpy(swap, _data, _length);
-			_capacity = _length;
-			Lupus::Swap(swap, _data);
-			delete swap;
+			// check argument
+			if (capacity < 0) {
+				throw ArgumentOutOfRangeException("capacity must be greater than or equal to zero");
+			}
 
-			if (_capacity <= 0) {
-				_data[0] = 0;
+			if (capacity > _capacity) {
+				Reallocate(capacity);
 			}
 		}
+
+		void String::ShrinkToFit()
+		{
+			// inline buffer can't shrink
+			if (IsSmall() || _capacity == _length) {
+				return;
+			}
+
+			Reallocate(_length);
+		}
 		
 		Vector<String> String::Split(const Vector<char>& delimiter, StringSplitOptions splitOptions) const
 		{
-			return Split(delimiter, _length, splitOptions);
+			return Split(CharSet(delimiter), _length + 1, splitOptions);
 		}
 
 		Vector<String> String::Split(const Vector<char>& delimiter, int count, StringSplitOptions splitOptions) const
+		{
+			return Split(CharSet(delimiter), count, splitOptions);
+		}
+
+		Vector<String> String::Split(const CharSet& delimiter, StringSplitOptions splitOptions) const
+		{
+			return Split(delimiter, _length + 1, splitOptions);
+		}
+
+		Vector<String> String::Split(const CharSet& delimiter, int count, StringSplitOptions splitOptions) const
 		{
 			// check argument
 			if (count < 0) {
@@ -548,17 +751,25 @@ namespace Lupus {
 
 		Vector<String> String::Split(const String& delimiter, StringSplitOptions splitOptions) const
 		{	
-			switch (splitOptions) {
-			case StringSplitOptions::None:
-				return SplitEmptyEntries(*this, delimiter, _length);
-			case StringSplitOptions::RemoveEmptyEntries:
-				return SplitNoEmptyEntries(*this, delimiter, _length);
+			return Split(*GetTextSearchStrategy()->Compile(delimiter, CaseSensitivity::CaseSensitive), _length + 1, splitOptions);
+		}
+
+		Vector<String> String::Split(const String& delimiter, int count, StringSplitOptions splitOptions) const
+		{
+			// check argument
+			if (count < 0) {
+				throw ArgumentOutOfRangeException("count is negativ");
 			}
 
-			return Vector<String>();
+			return Split(*GetTextSearchStrategy()->Compile(delimiter, CaseSensitivity::CaseSensitive), count, splitOptions);
 		}
 
-		Vector<String> String::Split(const String& delimiter, int count, StringSplitOptions splitOptions) const
+		Vector<String> String::Split(const CompiledPattern& delimiter, StringSplitOptions splitOptions) const
+		{
+			return Split(delimiter, _length + 1, splitOptions);
+		}
+
+		Vector<String> String::Split(const CompiledPattern& delimiter, int count, StringSplitOptions splitOptions) const
 		{
 			// check argument
 			if (count < 0) {
@@ -575,53 +786,87 @@ namespace Lupus {
 			return Vector<String>();
 		}
 
+		StringSplitter String::SplitLazy(const CharSet& delimiter, StringSplitOptions splitOptions) const
+		{
+			return StringSplitter(*this, delimiter, _length + 1, splitOptions);
+		}
+
+		StringSplitter String::SplitLazy(const CharSet& delimiter, int count, StringSplitOptions splitOptions) const
+		{
+			return StringSplitter(*this, delimiter, count, splitOptions);
+		}
+
+		StringSplitter String::SplitLazy(const StringView& delimiter, StringSplitOptions splitOptions) const
+		{
+			return StringSplitter(*this, GetTextSearchStrategy()->Compile(String(delimiter), CaseSensitivity::CaseSensitive), _length + 1, splitOptions);
+		}
+
+		StringSplitter String::SplitLazy(const StringView& delimiter, int count, StringSplitOptions splitOptions) const
+		{
+			return StringSplitter(*this, GetTextSearchStrategy()->Compile(String(delimiter), CaseSensitivity::CaseSensitive), count, splitOptions);
+		}
+
+		StringSplitter String::SplitLazy(const CompiledPattern& delimiter, StringSplitOptions splitOptions) const
+		{
+			return StringSplitter(*this, delimiter, _length + 1, splitOptions);
+		}
+
+		StringSplitter String::SplitLazy(const CompiledPattern& delimiter, int count, StringSplitOptions splitOptions) const
+		{
+			return StringSplitter(*this, delimiter, count, splitOptions);
+		}
+
 		String String::Substring(int startIndex) const
 		{
 			if (startIndex >= _length) {
 				throw ArgumentOutOfRangeException("startIndex exceeds string length");
-			} else if (startIndex < 0) {
-				throw ArgumentOutOfRangeException("startIndex must be greater than or equal to zero");
 			}
 
-			return String(_data + startIndex);
+			return String(View(startIndex));
 		}
 
 		String String::Substring(int startIndex, int count) const
 		{
-			if ((startIndex + count) >= _length) {
-				throw ArgumentOutOfRangeException("startIndex exceeds string length");
-			} else if (startIndex < 0) {
-				throw ArgumentOutOfRangeException("startIndex must be greater than or equal to zero");
-			} else if (count <= 0) {
+			if (count <= 0) {
 				throw ArgumentOutOfRangeException("length must be greater than zero");
 			}
 
-			return String(_data, startIndex, count);
+			return String(View(startIndex, count));
 		}
 
-		String& String::ToLower()
+		StringView String::View(int startIndex) const
 		{
-			// variables
-			const char* limit = _data + _length;
+			return StringView(*this).Substring(startIndex);
+		}
 
-			// compute result
-			for (char* ch = _data; ch != limit; ch++) {
-				(*ch) = static_cast<char>(tolower(*ch));
-			}
+		StringView String::View(int startIndex, int count) const
+		{
+			return StringView(*this).Substring(startIndex, count);
+		}
 
+		String& String::ToLower()
+		{
+			ToLowerChars(_data, _length);
+			ResetHashCode();
 			return (*this);
 		}
 
 		String& String::ToUpper()
 		{
-			// variables
-			const char* limit = _data + _length;
+			ToUpperChars(_data, _length);
+			ResetHashCode();
+			return (*this);
+		}
 
-			// compute result
-			for (char* ch = _data; ch != limit; ch++) {
-				(*ch) = static_cast<char>(toupper(*ch));
+		String& String::Transform(const ubyte* table)
+		{
+			// check argument
+			if (!table) {
+				throw ArgumentNullException("table must have a valid value");
 			}
 
+			TransformChars(_data, _length, table);
+			ResetHashCode();
 			return (*this);
 		}
 
@@ -633,6 +878,9 @@ namespace Lupus {
 				throw ArgumentOutOfRangeException("index must be greater than zero");
 			}
 
+			// char might be modified through returned reference at any time
+			_writable = true;
+			ResetHashCode();
 			return (_data[index]);
 		}
 
@@ -658,75 +906,82 @@ namespace Lupus {
 			int length = strlen(string);
 
 			// check if capacity is big enough
-			if (_capacity >= length) {
-				// set new values
-				strncpy(_data, string, length);
-				_data[length] = 0;
-				_length = length;
-			} else {
-				// reallocate buffer
-				delete[] _data;
-				_data = new char[length + 1];
-
-				// set new values
-				strncpy(_data, string, length);
-				_data[length] = 0;
-				_length = _capacity = length;
+			if (_capacity < length) {
+				Allocate(length);
 			}
 
+			// set new values
+			memmove(_data, string, length);
+			_data[length] = 0;
+			_length = length;
+			ResetHashCode();
+
 			return (*this);
 		}
 
 		String& String::operator=(const String& string)
 		{
 			// variables 
-			int length = string.Length;
+			int length = string._length;
 
 			// check if capacity is big enough
-			if (_capacity >= length) {
-				// set new values
-				strncpy(_data, string.Data, length);
-				_data[length] = 0;
-				_length = length;
-			} else {
-				// reallocate buffer
-				delete[] _data;
-				_data = new char[length + 1];
-
-				// set new values
-				strncpy(_data, string.Data, length);
-				_data[length] = 0;
-				_length = _capacity = length;
+			if (_capacity < length) {
+				Allocate(length);
 			}
 
+			// set new values
+			memmove(_data, string._data, length);
+			_data[length] = 0;
+			_length = length;
+			_hashCode.store(string._hashCode.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
 			return (*this);
 		}
 
 		String& String::operator=(String&& string)
 		{
-			Lupus::Swap(_data, string._data);
-			Lupus::Swap(_length, string._length);
-			Lupus::Swap(_capacity, string._capacity);
+			// check for self assignment
+			if (this == &string) {
+				return (*this);
+			}
+
+			if (string.IsSmall()) {
+				// inline content can't be taken over, so copy it
+				if (_capacity < string._length) {
+					Allocate(string._length);
+				}
+
+				memcpy(_data, string._data, string._length + 1);
+				_length = string._length;
+			} else {
+				// take over heap buffer
+				Deallocate();
+				_data = string._data;
+				_length = string._length;
+				_capacity = string._capacity;
+
+				// leave given instance as empty string
+				string._data = string._buffer;
+				string._data[0] = 0;
+				string._length = 0;
+				string._capacity = DEFAULT_ARRAY_SIZE - 1;
+			}
+
+			// references into a taken over buffer may still be written
+			_writable = (_writable || string._writable);
+			_hashCode.store(string._hashCode.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			string.ResetHashCode();
+
 			return (*this);
 		}
 
 		String& String::operator=(const Char& ch)
 		{
-			if (_capacity > 1) {
-				_data[0] = ch.Value;
-				_data[1] = 0;
-				_length = 1;
-			} else {
-				// reallocate buffer
-				delete[] _data;
-				_data = new char[DEFAULT_ARRAY_SIZE];
-
-				// set new values
-				_data[0] = ch.Value;
-				_data[1] = 0;
-				_length = 1;
-				_capacity = DEFAULT_ARRAY_SIZE - 1;
-			}
+			// capacity is always big enough for a single char
+			_data[0] = ch.Value;
+			_data[1] = 0;
+			_length = 1;
+			ResetHashCode();
 
 			return (*this);
 		}
@@ -734,95 +989,45 @@ namespace Lupus {
 		String String::operator+(const String& string) const
 		{
 			// variables
-			char* buffer = new char[_length + string.Length + 1];
+			String result;
 
-			// copy new buffer
-			strncpy(buffer, _data, _length);
-			strncpy(buffer + _length, string.Data, string.Length);
-			buffer[_length + string.Length] = 0;
+			// copy into result
+			result.Allocate(_length + string._length);
+			memcpy(result._data, _data, _length);
+			memcpy(result._data + _length, string._data, string._length);
+			result._length = _length + string._length;
+			result._data[result._length] = 0;
 
-			// set result and delete[] buffer
-			return CreateWithExistingBuffer(buffer);
+			return result;
 		}
 
 		String& String::operator+=(const char* str)
 		{
-			// variables
-			int length = strlen(str);
-
-			// check if capacity is big enough
-			if ((_capacity - _length) >= length) {
-				strncpy(_data + _length, str, length);
-				_length += length;
-			} else {
-				// new buffer
-				char* buffer = new char[_length + length + 1];
-
-				// copy new buffer
-				strncpy(buffer, _data, _length);
-				strncpy(buffer + _length, str, length);
-				buffer[_length + length] = 0;
-
-				// set result and delete[] buffer
-				delete[] _data;
-				_data = buffer;
-				_length += length;
-				_capacity += length;
+			// check argument
+			if (!str) {
+				throw ArgumentNullException("source string must have a valid value");
 			}
 
-			return (*this);
+			return Append(str, strlen(str));
 		}
 
 		String& String::operator+=(const String& string)
 		{
-			// variables
-			int length = string.Length;
-
-			// check if capacity is big enough
-			if ((_capacity - _length) >= length) {
-				strncpy(_data + _length, string.Data, length);
-				_length += length;
-			} else {
-				// new buffer
-				char* buffer = new char[_length + length + 1];
-				
-				// copy new buffer
-				strncpy(buffer, _data, _length);
-				strncpy(buffer + _length, string.Data, length);
-				buffer[_length + length] = 0;
-
-				// set result and delete[] buffer
-				delete[] _data;
-				_data = buffer;
-				_length += length;
-				_capacity += length;
-			}
-
-			return (*this);
+			return Append(string._data, string._length);
 		}
 
 		String& String::operator+=(const Char& ch)
 		{
-			if ((_capacity - _length) >= 1) {
-				_data[0] = ch.Value;
-				_data[1] = 0;
-				_length = 1;
-			} else {
-				// reallocate buffer
-				char* buffer = new char[_length + 2];
-
-				// copy new buffer
-				strncpy(buffer, _data, _length);
-				buffer[_length] = ch.Value;
-				buffer[_length + 1] = 0;
-
-				// set result and delete[] buffer
-				delete[] _data;
-				_data = buffer;
-				_length += 1;
-				_capacity += 1;
+			// check if capacity is big enough
+			if ((_capacity - _length) < 1) {
+				Grow(_length + 1);
 			}
 
+			// append
+			_data[_length++] = ch.Value;
+			_data[_length] = 0;
+			ResetHashCode();
+
 			return (*this);
 		}
 
@@ -849,6 +1054,7 @@ namespace Lupus {
 				}
 
 				Lupus::Swap(_data[first._current], _data[second._current]);
+				ResetHashCode();
 
 			} catch (...) {
 				throw InvalidIteratorException();
@@ -879,17 +1085,12 @@ namespace Lupus {
 		{
 			_data[0] = 0;
 			_length = 0;
+			ResetHashCode();
 		}
 
 		bool String::Contains(const char& ch) const
 		{
-			for (int i = _length - 1; i >= 0; i--) {
-				if (_data[i] == ch) {
-					return true;
-				}
-			}
-
-			return false;
+			return (FindChar(_data, _length, ch) != -1);
 		}
 
 		void String::CopyTo(Vector<char>& vector, int startIndex) const
@@ -945,14 +1146,19 @@ namespace Lupus {
 				throw ArgumentOutOfRangeException("index must be greater than zero");
 			}
 
-			// variables
-			String string(_length + 1);
+			// variables, given char might be part of this instance
+			char value = ch;
 
-			// set result
-			CopyTo(0, string, 0, index);
-			string[index] = ch;
-			CopyTo(index, string, index + 1, _length - index);
-			Lupus::Swap(string, *this);
+			// check if capacity is big enough
+			if ((_capacity - _length) < 1) {
+				Grow(_length + 1);
+			}
+
+			// shift tail including null char and set result
+			memmove(_data + index + 1, _data + index, _length - index + 1);
+			_data[index] = value;
+			_length += 1;
+			ResetHashCode();
 		}
 
 		bool String::IsEmpty() const
@@ -974,6 +1180,7 @@ namespace Lupus {
 			}
 
 			_length -= 1;
+			ResetHashCode();
 		}
 
 		void String::Resize(int count)
@@ -991,17 +1198,16 @@ namespace Lupus {
 					_length = count;
 				}
 			} else {
-				// new buffer
-				char* buffer = new char[count];
-
-				// copy old buffer delete it afterwards
-				strncpy(buffer, _data, _length);
-				delete[] _data;
+				// move content into bigger buffer and fill new space
+				Reallocate(count);
+				memset(_data + _length, ' ', count - _length);
 
-				// set internal buffer and length
-				_data = buffer;
-				_length = _capacity = count;
+				// set length
+				_length = count;
+				_data[_length] = 0;
 			}
+
+			ResetHashCode();
 		}
 
 		int String::Compare(const String& string) const
@@ -1010,27 +1216,36 @@ namespace Lupus {
 		}
 
 		String::String(int capacity) :
-			_data(new char[capacity + 1]),
-			_length(capacity),
-			_capacity(capacity),
-			_strategy(_defaultStrategy->Copy())
+			_data(_buffer),
+			_length(0),
+			_capacity(DEFAULT_ARRAY_SIZE - 1),
+			_strategy(nullptr),
+			_hashCode(0),
+			_writable(false)
 		{
+			Allocate(capacity);
 			memset(_data, ' ', capacity);
 			_data[capacity] = 0;
+			_length = capacity;
 		}
 
 		String String::CreateWithExistingBuffer(char* str)
 		{
 			// variables
 			String string;
+			int length = strlen(str);
 
-			// delete buffer
-			delete[] string._data;
+			if (length < DEFAULT_ARRAY_SIZE) {
+				// short content goes into the inline buffer
+				memcpy(string._data, str, length + 1);
+				delete[] str;
+			} else {
+				// take ownership of given buffer
+				string._data = str;
+				string._capacity = length;
+			}
 
-			// set values
-			string._data = str;
-			string._length = strlen(str);
-			string._capacity = string._length;
+			string._length = length;
 
 			// return result
 			return string;
@@ -1047,126 +1262,254 @@ namespace Lupus {
 			return result;
 		}
 
-		Vector<String> String::SplitEmptyEntries(const String& string, const Vector<char>& delimiter, int count)
+		Vector<String> String::SplitEmptyEntries(const String& string, const CharSet& delimiter, int count)
 		{
 			// variables
-			int lastIndex = -1;
+			int startIndex = 0;
+			int index = 0;
 			Vector<String> vector;
 
 			// compute result
-			for (int i = 0; i < string._length; i++) {
-				foreach(item, delimiter) {
-					if (string._data[i] != item->CurrentItem()) {
-						continue;
-					} else if (i == lastIndex + 1) {
-						vector.Add(String());
-					} else {
-						vector.Add(String(string._data, lastIndex + 1, i - lastIndex - 1));
-					}
+			while (vector.Length < count - 1 && (index = FindAnyChar(string._data + startIndex, string._length - startIndex, delimiter)) != -1) {
+				index += startIndex;
+				vector.Add((index == startIndex) ? String() : String(string._data, startIndex, index - startIndex));
+				startIndex = index + 1;
+			}
 
-					lastIndex = i;
+			vector.Add((startIndex == string._length) ? String() : String(string._data, startIndex, string._length - startIndex));
+			return vector;
+		}
 
-					if (vector.Length >= count - 1) {
-						vector.Add(String(string._data, lastIndex + 1, string._length - i - 1));
-						return vector;
-					}
+		Vector<String> String::SplitNoEmptyEntries(const String& string, const CharSet& delimiter, int count)
+		{
+			// variables
+			int startIndex = 0;
+			int index = 0;
+			Vector<String> vector;
 
-					break;
+			// compute result
+			while (vector.Length < count - 1 && (index = FindAnyChar(string._data + startIndex, string._length - startIndex, delimiter)) != -1) {
+				index += startIndex;
+
+				if (index != startIndex) {
+					vector.Add(String(string._data, startIndex, index - startIndex));
 				}
+
+				startIndex = index + 1;
 			}
 
-			if (lastIndex != string._length - 1) {
-				vector.Add(String(string._data, lastIndex + 1, string._length - lastIndex - 1));
+			if (startIndex != string._length) {
+				vector.Add(String(string._data, startIndex, string._length - startIndex));
 			}
 
 			return vector;
 		}
 
-		Vector<String> String::SplitNoEmptyEntries(const String& string, const Vector<char>& delimiter, int count)
+		Vector<String> String::SplitEmptyEntries(const String& string, const CompiledPattern& delimiter, int count)
 		{
 			// variables
-			int lastIndex = -1;
+			int length = delimiter.Length;
+			int startIndex = 0;
+			int index = 0;
 			Vector<String> vector;
 
-			// compute result
-			for (int i = 0; i < string._length; i++) {
-				foreach(item, delimiter) {
-					if (string._data[i] != item->CurrentItem()) {
-						continue;
-					} else if (i != lastIndex + 1) {
-						vector.Add(String(string._data, lastIndex + 1, i - lastIndex - 1));
-					}
+			// compute result, an empty delimiter never matches
+			while (length > 0 && vector.Length < count - 1 && (index = string.Find(delimiter, startIndex)) != -1) {
+				vector.Add((index == startIndex) ? String() : String(string._data, startIndex, index - startIndex));
+				startIndex = index + length;
+			}
 
-					lastIndex = i;
+			vector.Add((startIndex == string._length) ? String() : String(string._data, startIndex, string._length - startIndex));
+			return vector;
+		}
 
-					if (vector.Length >= count - 1) {
-						vector.Add(String(string._data, lastIndex + 1, string._length - i - 1));
-						return vector;
-					}
+		Vector<String> String::SplitNoEmptyEntries(const String& string, const CompiledPattern& delimiter, int count)
+		{
+			// variables
+			int length = delimiter.Length;
+			int startIndex = 0;
+			int index = 0;
+			Vector<String> vector;
 
-					break;
+			// compute result, an empty delimiter never matches
+			while (length > 0 && vector.Length < count - 1 && (index = string.Find(delimiter, startIndex)) != -1) {
+				if (index != startIndex) {
+					vector.Add(String(string._data, startIndex, index - startIndex));
 				}
+
+				startIndex = index + length;
 			}
 
-			if (lastIndex != string._length - 1) {
-				vector.Add(String(string._data, lastIndex + 1, string._length - lastIndex - 1));
+			if (startIndex != string._length) {
+				vector.Add(String(string._data, startIndex, string._length - startIndex));
 			}
 
 			return vector;
 		}
 
-		Vector<String> String::SplitEmptyEntries(const String& string, const String& delimiter, int count)
+		void String::Allocate(int capacity)
+		{
+			// current buffer is big enough
+			if (capacity <= _capacity) {
+				return;
+			}
+
+			// free old buffer
+			Deallocate();
+
+			// set new buffer
+			if (capacity >= DEFAULT_ARRAY_SIZE) {
+				_data = new char[capacity + 1];
+				_capacity = capacity;
+			}
+
+			_data[0] = 0;
+			_length = 0;
+		}
+
+		void String::Reallocate(int capacity)
 		{
 			// variables
-			int index = 0;
-			int lastIndex = -1;
-			Vector<String> vector;
+			char* buffer = nullptr;
 
-			while (index != -1) {
-				index = string.IndexOf(delimiter, lastIndex + 1);
-				
-				if (lastIndex + 1 == index) {
-					vector.Add(String());
-				} else {
-					// TODO: readable calculation
-					int startIndex = ((lastIndex == -1) ? (0) : (lastIndex + delimiter._length));
-					int length = ((index == -1) ? (string._length - lastIndex - delimiter._length) : (index - lastIndex - delimiter._length));
-					vector.Add(String(string._data, startIndex, length));
+			// check where content goes to
+			if (capacity < DEFAULT_ARRAY_SIZE) {
+				if (IsSmall()) {
+					return;
 				}
 
-				lastIndex = index;
+				buffer = _buffer;
+				capacity = DEFAULT_ARRAY_SIZE - 1;
+			} else {
+				buffer = new char[capacity + 1];
+			}
 
-				if (vector.Length >= count - 1) {
-					// TODO: readable calculation
-					int startIndex = ((lastIndex == -1) ? (0) : (lastIndex + delimiter._length));
-					int length = ((lastIndex == -1) ? (string._length) : (string._length - lastIndex - delimiter._length));
-					vector.Add(String(string._data, startIndex, length));
-					return vector;
-				}
+			// copy content and free old buffer
+			memcpy(buffer, _data, _length);
+			buffer[_length] = 0;
+
+			if (!IsSmall()) {
+				delete[] _data;
 			}
 
-			return vector;
+			_data = buffer;
+			_capacity = capacity;
+		}
+
+		void String::Grow(int capacity)
+		{
+			// double current capacity to keep appends amortized constant
+			int grown = _capacity * 2;
+
+			Reallocate((grown < capacity) ? capacity : grown);
+		}
+
+		void String::Deallocate()
+		{
+			if (!IsSmall()) {
+				delete[] _data;
+			}
+
+			_data = _buffer;
+			_data[0] = 0;
+			_length = 0;
+			_capacity = DEFAULT_ARRAY_SIZE - 1;
+		}
+
+		int String::Find(const char* search, int searchLength, int startIndex, CaseSensitivity sensitivity) const
+		{
+			// search pattern doesn't fit into remaining text
+			if (searchLength > (_length - startIndex)) {
+				return -1;
+			}
+
+			// compute result
+			int result = GetTextSearchStrategy()->Search(_data + startIndex, _length - startIndex, search, searchLength, sensitivity);
+
+			return (result == -1 ? -1 : (startIndex + result));
+		}
+
+		int String::Find(const CompiledPattern& pattern, int startIndex) const
+		{
+			// compute result
+			int result = pattern.Search(_data + startIndex, _length - startIndex);
+
+			return (result == -1 ? -1 : (startIndex + result));
 		}
 
-		Vector<String> String::SplitNoEmptyEntries(const String& string, const String& delimiter, int count)
+		String& String::ReplaceMatches(const Vector<PatternMatch>& matches, const String* after)
 		{
+			// nothing to replace
+			if (matches.IsEmpty()) {
+				return (*this);
+			}
+
 			// variables
-			int index = 0;
-			int lastIndex = -1;
-			Vector<String> vector;
+			int count = matches.Length;
+			int length = _length;
+			bool inPlace = true;
 
-			while ((index = string.IndexOf(delimiter, index)) != -1) {
-				if (lastIndex + 1 != index) {
-					vector.Add(String(string._data, lastIndex + delimiter.Length, index - lastIndex - 1));
-				}
+			// result length, the result doesn't grow if no replacement is longer than its match
+			for (int i = 0; i < count; i++) {
+				const String& replacement = after[matches[i].Pattern];
 
-				lastIndex = index;
+				length += replacement._length - matches[i].Length;
+				inPlace = inPlace && (replacement._length <= matches[i].Length) && (&replacement != this);
+			}
 
-				if (vector.Length >= count - 1) {
-					vector.Add(String(string._data, lastIndex + delimiter.Length, string._length - index - 1));
-					return vector;
-				}
+			// variables
+			String result;
+			char* destination = _data;
+			int source = 0;
+
+			// result doesn't grow, so it can be written from front to back into this instance
+			if (!inPlace) {
+				result.Allocate(length);
+				destination = result._data;
+			}
+
+			// copy unchanged ranges and replacements
+			for (int i = 0; i < count; i++) {
+				const PatternMatch& match = matches[i];
+				const String& replacement = after[match.Pattern];
+
+				memmove(destination, _data + source, match.Index - source);
+				destination += match.Index - source;
+				memcpy(destination, replacement._data, replacement._length);
+				destination += replacement._length;
+				source = match.Index + match.Length;
 			}
+
+			memmove(destination, _data + source, _length - source);
+
+			// set result
+			if (inPlace) {
+				_length = length;
+				_data[_length] = 0;
+			} else {
+				result._length = length;
+				result._data[length] = 0;
+				operator=(std::move(result));
+			}
+
+			ResetHashCode();
+
+			return (*this);
+		}
+
+		bool String::IsSmall() const
+		{
+			return (_data == _buffer);
+		}
+
+		void String::ResetHashCode()
+		{
+			_hashCode.store(0, std::memory_order_relaxed);
+		}
+
+		const ITextSearchStrategy* String::GetTextSearchStrategy() const
+		{
+			return (_strategy ? _strategy : &*_defaultStrategy);
 		}
 
 		String::StringIterator::StringIterator(const String* string) :
@@ -1205,101 +1548,64 @@ namespace Lupus {
 			return (_string->operator[](_current));
 		}
 
-		Pointer<ITextSearchStrategy> KnuthMorrisPratt::Copy() const
+		CompiledPattern::CompiledPattern(const char* search, int searchLength, CaseSensitivity sensitivity) :
+			_pattern(new char[searchLength + 1]),
+			_length(searchLength),
+			_sensitivity(sensitivity)
 		{
-			return new KnuthMorrisPratt();
+			memcpy(_pattern, search, searchLength);
+			_pattern[searchLength] = 0;
 		}
 
-		int KnuthMorrisPratt::Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const
+		CompiledPattern::~CompiledPattern()
 		{
-			switch (sensitivity) {
-			case CaseSensitivity::CaseSensitive:
-				return SearchSensitive(text, textLength, search, searchLength);
-			case CaseSensitivity::CaseInsensitive:
-				return SearchInsensitive(text, textLength, search, searchLength);
-			}
-
-			return -1;
+			delete[] _pattern;
 		}
 
-		int KnuthMorrisPratt::SearchSensitive(const char* text, int textLength, const char* search, int searchLength) const
+		int CompiledPattern::Search(const char* text, int textLength) const
 		{
-			// variables
-			int* n = new int[searchLength + 1];
-			int i = 0;
-			int j = -1;
-
-			// create prefix
-			n[0] = -1;
-
-			while (i < searchLength) {
-				while (j >= 0 && search[i] != search[j]) {
-					j = n[j];
-				}
-				i++;
-				j++;
-				n[i] = j;
-			}
-
-			// reset variables
-			i = j = 0;
-
-			// search
-			while (i < textLength) {
-				while (j >= 0 && text[i] != search[j]) {
-					j = n[j];
-				}
-				i++;
-				j++;
-
-				if (j == searchLength) {
-					delete[] n;
-					return (i - j);
-				}
+			// check arguments
+			if (_length == 0) {
+				return 0;
+			} else if (_length > textLength) {
+				return -1;
 			}
 
-			delete[] n;
-			return -1;
+			return Match(text, textLength);
 		}
 
-		int KnuthMorrisPratt::SearchInsensitive(const char* text, int textLength, const char* search, int searchLength) const
+		int CompiledPattern::Search(const StringView& text) const
 		{
-			// variables
-			int* n = new int[searchLength + 1];
-			int i = 0;
-			int j = -1;
-
-			// create prefix
-			n[0] = -1;
-
-			while (i < searchLength) {
-				while (j >= 0 && tolower(search[i]) != tolower(search[j])) {
-					j = n[j];
-				}
-				i++;
-				j++;
-				n[i] = j;
-			}
+			return Search(text.Data(), text.Length());
+		}
 
-			// reset variables
-			i = j = 0;
+		int ITextSearchStrategy::Search(const StringView& text, const StringView& search, CaseSensitivity sensitivity) const
+		{
+			return Search(text.Data(), text.Length(), search.Data(), search.Length(), sensitivity);
+		}
 
-			// search
-			while (i < textLength) {
-				while (j >= 0 && tolower(text[i]) != tolower(search[j])) {
-					j = n[j];
+		namespace {
+			//! forwards every search to a text search algorithm without preprocessing
+			class StrategyPattern : public CompiledPattern
+			{
+				const ITextSearchStrategy* _strategy;
+			public:
+				StrategyPattern(const ITextSearchStrategy* strategy, const char* search, int searchLength, CaseSensitivity sensitivity) :
+					CompiledPattern(search, searchLength, sensitivity),
+					_strategy(strategy)
+				{
 				}
-				i++;
-				j++;
-
-				if (j == searchLength) {
-					delete[] n;
-					return (i - j);
+			protected:
+				virtual int Match(const char* text, int textLength) const override
+				{
+					return _strategy->Search(text, textLength, _pattern, _length, _sensitivity);
 				}
-			}
+			};
+		}
 
-			delete[] n;
-			return -1;
+		Pointer<CompiledPattern> ITextSearchStrategy::Compile(const String& pattern, CaseSensitivity sensitivity) const
+		{
+			return new StrategyPattern(this, pattern.Data, pattern.Length, sensitivity);
 		}
 	}
 }
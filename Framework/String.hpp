@@ -25,6 +25,8 @@
 #include "Iterator.hpp"
 #include "IComparable.hpp"
 #include "ICopyable.hpp"
+#include "StringView.hpp"
+#include <atomic>
 
 namespace Lupus {
 	namespace System {
@@ -32,9 +34,80 @@ namespace Lupus {
 		template <typename T>
 		class Vector;
 		class String;
+		class StringBuilder;
 		class StringIterator;
+		class AhoCorasick;
+		class CharSet;
+		class StringSplitter;
+		struct PatternMatch;
 
-		//! text search algorithm interface
+		/**
+		 * search pattern preprocessed by a text search algorithm
+		 *
+		 * created once with ITextSearchStrategy::Compile and reusable for any number of texts,
+		 * so the tables of the algorithm aren't rebuilt for every search
+		 */
+		class LUPUS_API CompiledPattern
+		{
+		protected:
+			//! copy of the pattern
+			char* _pattern;
+			//! pattern length
+			int _length;
+			//! case sensitivity the pattern was compiled for
+			CaseSensitivity _sensitivity;
+			/**
+			 * Copy pattern for derived classes
+			 *
+			 * @param search native search pattern string
+			 * @param searchLength length of search pattern string
+			 * @param sensitivity search case sensitive or case insensitive
+			 */
+			CompiledPattern(const char* search, int searchLength, CaseSensitivity sensitivity);
+			/**
+			 * searches for the pattern, called only for non empty patterns which fit into the text
+			 *
+			 * @param text native search string
+			 * @param textLength length of search string without the null char
+			 * @return index at first occurrence or -1
+			 */
+			virtual int Match(const char* text, int textLength) const = 0;
+		public:
+			//! Return pattern length
+			PropertyReader<int> Length = PropertyReader<int>(_length);
+			//! Return native pattern
+			PropertyReader<char*> Data = PropertyReader<char*>(_pattern);
+			//! Return case sensitivity the pattern was compiled for
+			PropertyReader<CaseSensitivity> Sensitivity = PropertyReader<CaseSensitivity>(_sensitivity);
+			CompiledPattern(const CompiledPattern&) = delete;
+			CompiledPattern(CompiledPattern&&) = delete;
+			//! Destructor
+			virtual ~CompiledPattern();
+			/**
+			 * searches for the pattern in a text and return index to its first occurrence
+			 *
+			 * @param text native search string
+			 * @param textLength length of search string without the null char
+			 * @return index at first occurrence or -1 if pattern don't exist within given string
+			 */
+			int Search(const char* text, int textLength) const;
+			/**
+			 * searches for the pattern in a view
+			 *
+			 * @param text viewed search string
+			 * @return index at first occurrence or -1 if pattern don't exist within given view
+			 */
+			int Search(const StringView& text) const;
+			CompiledPattern& operator=(const CompiledPattern&) = delete;
+			CompiledPattern& operator=(CompiledPattern&&) = delete;
+		};
+
+		/**
+		 * text search algorithm interface
+		 *
+		 * implementations must be stateless, because a single instance is shared
+		 * between all strings using it
+		 */
 		class LUPUS_API ITextSearchStrategy : public ICopyable<ITextSearchStrategy>
 		{
 		public:
@@ -50,6 +123,26 @@ namespace Lupus {
 			 * @return index at first occurrence or -1 if search pattern don't exist within given string
 			 */
 			virtual int Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const = 0;
+			/**
+			 * searches for a view in another view, forwards to the native search
+			 *
+			 * @param text viewed search string
+			 * @param search viewed search pattern
+			 * @param sensitivity search case sensitive or case insensitive
+			 * @return index at first occurrence or -1 if search pattern don't exist within given view
+			 */
+			int Search(const StringView& text, const StringView& search, CaseSensitivity sensitivity) const;
+			/**
+			 * preprocesses a pattern once for repeated searches
+			 *
+			 * the default implementation doesn't preprocess anything and forwards every search
+			 * to Search, so this instance has to outlive the returned pattern
+			 *
+			 * @param pattern search pattern
+			 * @param sensitivity search case sensitive or case insensitive
+			 * @return compiled pattern
+			 */
+			virtual Pointer<CompiledPattern> Compile(const String& pattern, CaseSensitivity sensitivity) const;
 		};
 
 		//! string split flag
@@ -61,27 +154,33 @@ namespace Lupus {
 		//! String class used for internal string operations
 		class LUPUS_API String : public Object, public ISequence<char>, public IComparable<String>
 		{
+			friend class StringBuilder;
+			friend class StringView;
 			//! native string
 			char* _data;
 			//! string length
 			int _length;
 			//! string capacity
 			int _capacity;
-			//! text search algorithm
-			Pointer<ITextSearchStrategy> _strategy;
-			//! default search algorithm
+			//! inline storage for short strings, _data points here until the content outgrows it
+			char _buffer[DEFAULT_ARRAY_SIZE];
+			//! text search algorithm for this instance, nullptr uses the default algorithm
+			const ITextSearchStrategy* _strategy;
+			//! cached case sensitive hash code, zero until computed and reset by every modification
+			mutable std::atomic<ulong> _hashCode;
+			//! set once operator[] handed out a writable reference, the hash code isn't cached from then on
+			bool _writable;
+			//! default search algorithm shared by all strings
 			static Pointer<ITextSearchStrategy> _defaultStrategy;
 		public:
 			//! Return string length
 			PropertyReader<int> Length = PropertyReader<int>(_length);
 			//! Return string capacity
 			PropertyReader<int> Capacity = PropertyReader<int>(_capacity);
-			//! Return native string
-			PropertyReader<char*> Data = PropertyReader<char*>(_data);
-			//! Set text search algorithm
-			PropertyWriter<Pointer<ITextSearchStrategy>> TextSearchAlgorithm = PropertyWriter<Pointer<ITextSearchStrategy>>(_strategy);
-			//! Set default serach algorithm
-			static PropertyWriter<Pointer<ITextSearchStrategy>> DefaultTextSearchAlgorithm;
+			//! Return native string, read only since the hash code is cached
+			PropertyReader<const char*> Data = PropertyReader<const char*>(const_cast<const char*&>(_data));
+			//! Set text search algorithm for this instance, nullptr restores the default, copies don't inherit it
+			PropertyWriter<const ITextSearchStrategy*> TextSearchAlgorithm = PropertyWriter<const ITextSearchStrategy*>(_strategy);
 			//! Create an empty string
 			String();
 			/**
@@ -122,14 +221,41 @@ namespace Lupus {
 			 * @param length length beginning from start index
 			 */
 			String(const Char* source, int startIndex, int length);
+			/**
+			 * Create an instance from the chars of a view
+			 *
+			 * @param view chars to copy
+			 */
+			explicit String(const StringView& view);
 			//! Copy string from given instance to this instance
 			String(const String& string);
 			//! Move string from given instance to this instance
 			String(String&& string);
-			//! \sa String::String(const char*)
-			String(const wchar_t*);
-			//! \sa String::String(const char*, int, int)
-			String(const wchar_t*, int startIndex, int length);
+			/**
+			 * Convert a null terminated wide string to utf-8
+			 *
+			 * wide strings are utf-16 on windows and utf-32 on unix
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 * - EncodingException
+			 *
+			 * @param source wide string
+			 */
+			String(const wchar_t* source);
+			/**
+			 * Convert length wide chars starting at given index to utf-8
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 * - ArgumentOutOfRangeException
+			 * - EncodingException
+			 *
+			 * @param source wide string
+			 * @param startIndex index of first converted wide char
+			 * @param length number of converted wide chars
+			 */
+			String(const wchar_t* source, int startIndex, int length);
 			//! Destructor
 			virtual ~String();
 			/**
@@ -145,13 +271,78 @@ namespace Lupus {
 			 */
 			String& Append(const Char& ch);
 			/**
-			 * Compare two intances and return there difference
+			 * Append given native string to this instance
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 *
+			 * @param str native string to append
+			 */
+			String& Append(const char* str);
+			/**
+			 * Append count chars from given native string to this instance.
+			 * Reuses free capacity and grows the buffer geometrically if required.
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param str native string to append, doesn't need to be null terminated
+			 * @param count how many chars are appended
+			 */
+			String& Append(const char* str, int count);
+			/**
+			 * Compare this instance to a view and return there difference
 			 *
-			 * @param string instance to be compared to this instance
+			 * @param string view to be compared to this instance
 			 * @param sensitivity flag for case sensitivity
 			 * @return zero if the two strings are equal, else the difference at the first deviation
 			 */
-			int Compare(const String& string, CaseSensitivity sensitivity) const;
+			int Compare(const StringView& string, CaseSensitivity sensitivity) const;
+			/**
+			 * Compare this instance to a view case insensitive with tolower of the current locale
+			 *
+			 * \sa StringView::CompareLocale
+			 */
+			int CompareLocale(const StringView& string) const;
+			/**
+			 * Compute a hash code from the content of this instance
+			 *
+			 * equal strings have equal hash codes. the hash code is cached until this instance
+			 * is modified.
+			 *
+			 * @return case sensitive hash code
+			 */
+			virtual ulong GetHashCode() const override;
+			/**
+			 * Compute a hash code from the content of this instance
+			 *
+			 * case insensitive hash codes are equal for strings which are equal when compared
+			 * case insensitive, they aren't cached.
+			 *
+			 * @param sensitivity flag for case sensitivity
+			 * @return hash code
+			 */
+			ulong GetHashCode(CaseSensitivity sensitivity) const;
+			/**
+			 * Preprocess a pattern with the default text search algorithm for repeated searches
+			 *
+			 * @param pattern search pattern
+			 * @param sensitivity flag for case sensitivity
+			 * @return compiled pattern usable with IndexOf, Contains, Replace and Split
+			 */
+			static Pointer<CompiledPattern> Compile(const String& pattern, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+			/**
+			 * Set default search algorithm used by every string without an algorithm of its own
+			 *
+			 * takes ownership of the algorithm and releases the previous default.
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 *
+			 * @param strategy heap allocated search algorithm
+			 */
+			static void SetDefaultTextSearchAlgorithm(Pointer<ITextSearchStrategy>&& strategy);
 			/**
 			 * Check if this instance contains a specific value
 			 *
@@ -159,7 +350,14 @@ namespace Lupus {
 			 * @param sensitivity flag for case sensitivity
 			 * @return true if this instance contains given string
 			 */
-			bool Contains(const String& string, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			bool Contains(const StringView& string, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Check if this instance contains a compiled pattern
+			 *
+			 * @param pattern compiled pattern to be checked
+			 * @return true if this instance contains given pattern
+			 */
+			bool Contains(const CompiledPattern& pattern) const;
 			/**
 			 * Search for given char within this instance
 			 *
@@ -205,7 +403,18 @@ namespace Lupus {
 			 * @param sensitivity defines the case sensitivity for search process
 			 * @return index of first match or -1 if no such string was found
 			 */
-			int IndexOf(const String& string, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			int IndexOf(const StringView& string, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Search for a compiled pattern within this instance
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param pattern compiled pattern to search for
+			 * @param startIndex at what index begins the search for this instance
+			 * @return index of first match or -1 if the pattern wasn't found
+			 */
+			int IndexOf(const CompiledPattern& pattern, int startIndex = 0) const;
 			/**
 			 * Search for given chars within this instance
 			 *
@@ -218,6 +427,55 @@ namespace Lupus {
 			 * @return index of first match or -1 if non of the given chars was found
 			 */
 			int IndexOfAny(const ISequence<char>& sequence, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Search for any char of a set within this instance
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param set chars to search for
+			 * @param startIndex at what index begins the search for this instance
+			 * @return index of first match or -1 if non of the given chars was found
+			 */
+			int IndexOfAny(const CharSet& set, int startIndex = 0) const;
+			/**
+			 * Search for any of given strings within a single pass
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param patterns strings to search for
+			 * @param startIndex at what index begins the search for this instance
+			 * @param sensitivity defines the case sensitivity for search process
+			 * @return index of leftmost match or -1 if non of the given strings was found
+			 */
+			int IndexOfAny(const Vector<String>& patterns, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Search for any pattern of a prebuilt automaton within a single pass
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param automaton patterns to search for
+			 * @param startIndex at what index begins the search for this instance
+			 * @return index of leftmost match or -1 if non of the patterns was found
+			 */
+			int IndexOfAny(const AhoCorasick& automaton, int startIndex = 0) const;
+			/**
+			 * Search for all matches of given strings within a single pass
+			 *
+			 * @param patterns strings to search for
+			 * @param sensitivity defines the case sensitivity for search process
+			 * @return all matches including overlapping ones ordered by their end
+			 */
+			Vector<PatternMatch> FindAll(const Vector<String>& patterns, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Search for all matches of the patterns of a prebuilt automaton within a single pass
+			 *
+			 * @param automaton patterns to search for
+			 * @return all matches including overlapping ones ordered by their end
+			 */
+			Vector<PatternMatch> FindAll(const AhoCorasick& automaton) const;
 			/**
 			 * Search for the last occurence of given char within this instance
 			 *
@@ -241,7 +499,7 @@ namespace Lupus {
 			 * @param sensitivity defines the case sensitivity for search process
 			 * @return index of last match or -1 if no such string was found
 			 */
-			int LastIndexOf(const String& string, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			int LastIndexOf(const StringView& string, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
 			/**
 			 * Search for the last occurence of given chars within this instance
 			 *
@@ -254,6 +512,17 @@ namespace Lupus {
 			 * @return index of first match or -1 if non of the given chars was found
 			 */
 			int LastIndexOfAny(const ISequence<char>& sequence, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Search for the last occurence of any char of a set within this instance
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param set chars to search for
+			 * @param startIndex at what index begins the search for this instance, counting from the last position
+			 * @return index of last match or -1 if non of the given chars was found
+			 */
+			int LastIndexOfAny(const CharSet& set, int startIndex = 0) const;
 			/**
 			 * Removes all char from given index to the end of string
 			 *
@@ -290,16 +559,90 @@ namespace Lupus {
 			 * @return reference to this instance
 			 */
 			String& Replace(const String& before, const String& after, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
+			/**
+			 * Replace all matches of a compiled pattern with given replacement string
+			 *
+			 * @param before compiled pattern
+			 * @param after new string
+			 * @return reference to this instance
+			 */
+			String& Replace(const CompiledPattern& before, const String& after);
+			/**
+			 * Replace all matching strings of several patterns within a single pass.
+			 * On overlapping matches the leftmost one wins, on equal positions the longest pattern.
+			 *
+			 * \b Exceptions
+			 * - ArgumentException
+			 *
+			 * @param before old strings
+			 * @param after new strings, one for every entry in before
+			 * @param sensitivity defines the case sensitivity for replace process
+			 * @return reference to this instance
+			 */
+			String& ReplaceAll(const Vector<String>& before, const Vector<String>& after, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive);
 			/**
 			 * Reverse the whole string
 			 * @return reference to this instance
 			 */
 			String& Reverse();
+			/**
+			 * Make sure this instance can hold at least capacity chars without reallocation
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param capacity minimum capacity without the null char
+			 */
+			void Reserve(int capacity);
 			void ShrinkToFit();
 			Vector<String> Split(const Vector<char>&, StringSplitOptions = StringSplitOptions::None) const;
 			Vector<String> Split(const Vector<char>&, int, StringSplitOptions = StringSplitOptions::None) const;
+			Vector<String> Split(const CharSet&, StringSplitOptions = StringSplitOptions::None) const;
+			Vector<String> Split(const CharSet&, int, StringSplitOptions = StringSplitOptions::None) const;
 			Vector<String> Split(const String&, StringSplitOptions = StringSplitOptions::None) const;
 			Vector<String> Split(const String&, int, StringSplitOptions = StringSplitOptions::None) const;
+			Vector<String> Split(const CompiledPattern&, StringSplitOptions = StringSplitOptions::None) const;
+			Vector<String> Split(const CompiledPattern&, int, StringSplitOptions = StringSplitOptions::None) const;
+			/**
+			 * Split this instance lazily at any of given chars
+			 *
+			 * tokens are views onto this instance, found one by one while iterating, so this
+			 * instance must not be modified or destroyed before the splitter
+			 *
+			 * @param delimiter delimiter chars
+			 * @param options split flag
+			 * @return iterable splitter yielding the tokens
+			 */
+			StringSplitter SplitLazy(const CharSet& delimiter, StringSplitOptions options = StringSplitOptions::None) const;
+			/**
+			 * \sa String::SplitLazy(const CharSet&, StringSplitOptions)
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param count maximum number of tokens, the last token holds the remaining text
+			 */
+			StringSplitter SplitLazy(const CharSet& delimiter, int count, StringSplitOptions options = StringSplitOptions::None) const;
+			/**
+			 * Split this instance lazily at every occurrence of a delimiter string
+			 *
+			 * the delimiter is compiled once with the text search algorithm of this instance
+			 *
+			 * \sa String::SplitLazy(const CharSet&, StringSplitOptions)
+			 */
+			StringSplitter SplitLazy(const StringView& delimiter, StringSplitOptions options = StringSplitOptions::None) const;
+			//! \sa String::SplitLazy(const CharSet&, int, StringSplitOptions)
+			StringSplitter SplitLazy(const StringView& delimiter, int count, StringSplitOptions options = StringSplitOptions::None) const;
+			/**
+			 * Split this instance lazily at every match of a compiled pattern
+			 *
+			 * the pattern isn't copied and has to outlive the splitter
+			 *
+			 * \sa String::SplitLazy(const CharSet&, StringSplitOptions)
+			 */
+			StringSplitter SplitLazy(const CompiledPattern& delimiter, StringSplitOptions options = StringSplitOptions::None) const;
+			//! \sa String::SplitLazy(const CharSet&, int, StringSplitOptions)
+			StringSplitter SplitLazy(const CompiledPattern& delimiter, int count, StringSplitOptions options = StringSplitOptions::None) const;
 			/**
 			 * Create substring at starting index from this instance
 			 *
@@ -321,19 +664,57 @@ namespace Lupus {
 			 * @return new substring from this instance
 			 */
 			String Substring(int startIndex, int count) const;
+			/**
+			 * Create a view starting at given index without copying
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param startIndex starting index within this instance
+			 * @return view onto the remaining chars, invalidated by any modification of this instance
+			 */
+			StringView View(int startIndex) const;
+			/**
+			 * Create a view onto count chars starting at given index without copying
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param startIndex starting index within this instance
+			 * @param count how many chars are viewed
+			 * @return view onto given range, invalidated by any modification of this instance
+			 */
+			StringView View(int startIndex, int count) const;
 			/**
 			 * Convert all chars from this instance to its lower equivalent
 			 *
+			 * converts ascii letters and utf-8 encoded latin-1 letters, independent of the locale
+			 *
 			 * @return reference to this instance
 			 */
 			String& ToLower();
 			/**
 			 * Convert all chars from this instance to its upper equivalent
 			 *
+			 * converts ascii letters and utf-8 encoded latin-1 letters, independent of the locale
+			 *
 			 * @return reference to this instance
 			 */
 			String& ToUpper();
 			/**
+			 * Replace every char of this instance by its entry within a table
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 *
+			 * @param table replacement for every unsigned char value, 256 entries
+			 * @return reference to this instance
+			 */
+			String& Transform(const ubyte* table);
+			/**
+			 * the returned reference may be written at any time, so this instance
+			 * stops caching its hash code
+			 *
 			 * \b Exceptions
 			 * - ArgumentOutOfRangeException
 			 *
@@ -454,11 +835,57 @@ namespace Lupus {
 			explicit String(int);
 			static String CreateWithExistingBuffer(char*);
 			static int GetLength(const Char*);
-			static Vector<String> SplitEmptyEntries(const String&, const Vector<char>&, int);
-			static Vector<String> SplitNoEmptyEntries(const String&, const Vector<char>&, int);
-			static Vector<String> SplitEmptyEntries(const String&, const String&, int);
-			static Vector<String> SplitNoEmptyEntries(const String&, const String&, int);
+			static Vector<String> SplitEmptyEntries(const String&, const CharSet&, int);
+			static Vector<String> SplitNoEmptyEntries(const String&, const CharSet&, int);
+			static Vector<String> SplitEmptyEntries(const String&, const CompiledPattern&, int);
+			static Vector<String> SplitNoEmptyEntries(const String&, const CompiledPattern&, int);
 		private:
+			/**
+			 * Provide room for at least capacity chars, current content may be discarded.
+			 * Uses the inline buffer if capacity fits into it.
+			 *
+			 * @param capacity required capacity without the null char
+			 */
+			void Allocate(int capacity);
+			/**
+			 * Move current content into a buffer with given capacity
+			 *
+			 * @param capacity new capacity without the null char, must be greater than or equal to length
+			 */
+			void Reallocate(int capacity);
+			/**
+			 * Grow buffer geometrically, so that it can hold at least capacity chars
+			 *
+			 * @param capacity required capacity without the null char
+			 */
+			void Grow(int capacity);
+			//! free heap buffer if there is one and switch back to the inline buffer
+			void Deallocate();
+			//! forget the cached hash code after a modification
+			void ResetHashCode();
+			//! check if content is stored within the inline buffer
+			bool IsSmall() const;
+			//! get text search algorithm for this instance
+			const ITextSearchStrategy* GetTextSearchStrategy() const;
+			/**
+			 * search for a native string without argument checks
+			 *
+			 * @return absolute index of first match at or after startIndex or -1
+			 */
+			int Find(const char* search, int searchLength, int startIndex, CaseSensitivity sensitivity) const;
+			/**
+			 * search for a compiled pattern without argument checks
+			 *
+			 * @return absolute index of first match at or after startIndex or -1
+			 */
+			int Find(const CompiledPattern& pattern, int startIndex) const;
+			/**
+			 * replace non overlapping matches in a single pass
+			 *
+			 * @param matches matches ordered by index
+			 * @param after replacements, selected by the pattern index of every match
+			 */
+			String& ReplaceMatches(const Vector<PatternMatch>& matches, const String* after);
 			class StringIterator : public Iterator<char>
 			{
 				friend class String;
@@ -483,13 +910,13 @@ namespace Lupus {
 		class LUPUS_API KnuthMorrisPratt : public ITextSearchStrategy
 		{
 		public:
+			using ITextSearchStrategy::Search;
 			//! \sa ICopyable::Copy
 			virtual Pointer<ITextSearchStrategy> Copy() const override;
 			//! \sa TextSearchStrategy::Search
 			virtual int Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const override;
-		private:
-			int SearchSensitive(const char* text, int textLength, const char* search, int searchLength) const;
-			int SearchInsensitive(const char* text, int textLength, const char* search, int searchLength) const;
+			//! \sa TextSearchStrategy::Compile
+			virtual Pointer<CompiledPattern> Compile(const String& pattern, CaseSensitivity sensitivity) const override;
 		};
 
 		template <typename T>
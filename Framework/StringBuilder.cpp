@@ -0,0 +1,294 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StringBuilder.hpp"
+#include "String.hpp"
+#include "Char.hpp"
+#include "Exception.hpp"
+#include <cstring>
+
+static const int sMinimumChunkSize = 256;
+static const int sMaximumChunkSize = 8192;
+
+namespace Lupus {
+	namespace System {
+		StringBuilder::StringBuilder() :
+			_first(nullptr),
+			_last(nullptr),
+			_length(0)
+		{
+		}
+
+		StringBuilder::StringBuilder(int capacity) :
+			_first(nullptr),
+			_last(nullptr),
+			_length(0)
+		{
+			// check argument
+			if (capacity <= 0) {
+				throw ArgumentOutOfRangeException("capacity must be greater than zero");
+			}
+
+			AddChunk(capacity);
+		}
+
+		StringBuilder::StringBuilder(StringBuilder&& builder) :
+			_first(builder._first),
+			_last(builder._last),
+			_length(builder._length)
+		{
+			builder._first = builder._last = nullptr;
+			builder._length = 0;
+		}
+
+		StringBuilder::~StringBuilder()
+		{
+			FreeChunks();
+		}
+
+		StringBuilder& StringBuilder::Append(const String& string)
+		{
+			return Append(string._data, string._length);
+		}
+
+		StringBuilder& StringBuilder::Append(const Char& ch)
+		{
+			(*Prepare(1)) = ch.Value;
+			Commit(1);
+			return (*this);
+		}
+
+		StringBuilder& StringBuilder::Append(const char* str)
+		{
+			// check argument
+			if (!str) {
+				throw ArgumentNullException("source string must have a valid value");
+			}
+
+			return Append(str, strlen(str));
+		}
+
+		StringBuilder& StringBuilder::Append(const char* str, int count)
+		{
+			// check arguments
+			if (!str) {
+				throw ArgumentNullException("source string must have a valid value");
+			} else if (count < 0) {
+				throw ArgumentOutOfRangeException("count must be greater than or equal to zero");
+			}
+
+			// fill last block and continue in a new one
+			while (count > 0) {
+				if (!_last || _last->length == _last->capacity) {
+					AddChunk(count);
+				}
+
+				// variables
+				int space = _last->capacity - _last->length;
+				int size = (count < space) ? count : space;
+
+				// copy content
+				memcpy(_last->data + _last->length, str, size);
+				_last->length += size;
+				_length += size;
+				str += size;
+				count -= size;
+			}
+
+			return (*this);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(sbyte value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(short value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(int value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(long value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(llong value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(ubyte value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(ushort value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(uint value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(ulong value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(ullong value, IntegerBase base)
+		{
+			return AppendNumber(value, base);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(float value, FloatFormat format, int precision)
+		{
+			Commit(Float::FormatTo(Prepare(Float::MaxFormatLength - 1), value, format, precision));
+			return (*this);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(double value, FloatFormat format, int precision)
+		{
+			Commit(Float::FormatTo(Prepare(Float::MaxFormatLength - 1), value, format, precision));
+			return (*this);
+		}
+
+		StringBuilder& StringBuilder::AppendFormat(real value)
+		{
+			// written in place where real is a double, like Float::ToString does
+			if (sizeof(real) == sizeof(double)) {
+				return AppendFormat(static_cast<double>(value));
+			}
+
+			return Append(Float::ToString(value));
+		}
+
+		void StringBuilder::Clear()
+		{
+			// variables
+			Chunk* first = _first;
+
+			// keep first block for reuse
+			if (first) {
+				_first = first->next;
+				FreeChunks();
+				first->length = 0;
+				first->next = nullptr;
+			}
+
+			_first = _last = first;
+			_length = 0;
+		}
+
+		String StringBuilder::ToString() const
+		{
+			// variables
+			char* buffer = new char[_length + 1];
+			char* position = buffer;
+
+			// copy all blocks
+			for (Chunk* chunk = _first; chunk; chunk = chunk->next) {
+				memcpy(position, chunk->data, chunk->length);
+				position += chunk->length;
+			}
+
+			(*position) = 0;
+
+			return String::CreateWithExistingBuffer(buffer);
+		}
+
+		StringBuilder& StringBuilder::operator=(StringBuilder&& builder)
+		{
+			Lupus::Swap(_first, builder._first);
+			Lupus::Swap(_last, builder._last);
+			Lupus::Swap(_length, builder._length);
+			return (*this);
+		}
+
+		char* StringBuilder::Prepare(int count)
+		{
+			// check if last block has enough space
+			if (!_last || (_last->capacity - _last->length) <= count) {
+				AddChunk(count + 1);
+			}
+
+			return (_last->data + _last->length);
+		}
+
+		void StringBuilder::Commit(int count)
+		{
+			_last->length += count;
+			_length += count;
+		}
+
+		void StringBuilder::AddChunk(int count)
+		{
+			// variables, block size follows total length
+			int size = (_length < sMinimumChunkSize) ? sMinimumChunkSize : _length;
+			Chunk* chunk = new Chunk();
+
+			if (size > sMaximumChunkSize) {
+				size = sMaximumChunkSize;
+			}
+
+			if (size < count) {
+				size = count;
+			}
+
+			// set new block
+			chunk->data = new char[size];
+			chunk->length = 0;
+			chunk->capacity = size;
+			chunk->next = nullptr;
+
+			if (_last) {
+				_last->next = chunk;
+			} else {
+				_first = chunk;
+			}
+
+			_last = chunk;
+		}
+
+		void StringBuilder::FreeChunks()
+		{
+			while (_first) {
+				Chunk* chunk = _first;
+				_first = chunk->next;
+				delete[] chunk->data;
+				delete chunk;
+			}
+
+			_last = nullptr;
+		}
+
+		template <typename T>
+		StringBuilder& StringBuilder::AppendNumber(T value, IntegerBase base)
+		{
+			Commit(Integer::FormatTo(Prepare(Integer::MaxFormatLength - 1), value, base));
+			return (*this);
+		}
+	}
+}
@@ -0,0 +1,167 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_STRINGBUILDER_HPP
+#define LUPUS_STRINGBUILDER_HPP
+
+#include "Types.hpp"
+#include "Integer.hpp"
+#include "Float.hpp"
+
+namespace Lupus {
+	namespace System {
+		// declarations
+		class Char;
+		class String;
+
+		//! collects string fragments in chunks and creates the resulting string with a single allocation
+		class LUPUS_API StringBuilder : public Object
+		{
+			//! single storage block, full blocks are never reallocated
+			struct Chunk
+			{
+				char* data;
+				int length;
+				int capacity;
+				Chunk* next;
+			};
+
+			//! first storage block
+			Chunk* _first;
+			//! storage block for appending
+			Chunk* _last;
+			//! total length of all blocks
+			int _length;
+		public:
+			//! Return length of collected content
+			PropertyReader<int> Length = PropertyReader<int>(_length);
+			//! Create an empty builder
+			StringBuilder();
+			/**
+			 * Create an empty builder with given initial capacity
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param capacity size of first storage block
+			 */
+			explicit StringBuilder(int capacity);
+			StringBuilder(const StringBuilder&) = delete;
+			//! Move content from given instance to this instance
+			StringBuilder(StringBuilder&&);
+			//! Destructor
+			virtual ~StringBuilder();
+			//! append given string
+			StringBuilder& Append(const String& string);
+			//! append a single char
+			StringBuilder& Append(const Char& ch);
+			/**
+			 * append given native string
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 */
+			StringBuilder& Append(const char* str);
+			/**
+			 * append count chars from given native string
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param str native string, doesn't need to be null terminated
+			 * @param count how many chars are appended
+			 */
+			StringBuilder& Append(const char* str, int count);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(sbyte value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(short value, IntegerBase base = IntegerBase::Decimal);
+			/**
+			 * write text representation of an integer directly into this builder
+			 *
+			 * @param value integer to append
+			 * @param base either octal, decimal or hexadecimal
+			 * @return reference to this instance
+			 */
+			StringBuilder& AppendFormat(int value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(long value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(llong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(ubyte value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(ushort value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(uint value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(ulong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(int, IntegerBase)
+			StringBuilder& AppendFormat(ullong value, IntegerBase base = IntegerBase::Decimal);
+			//! \sa StringBuilder::AppendFormat(double, FloatFormat, int)
+			StringBuilder& AppendFormat(float value, FloatFormat format = FloatFormat::General, int precision = -1);
+			/**
+			 * write text representation of a floating-point number directly into this builder
+			 *
+			 * uses the same format as Float::ToString.
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param value number to append
+			 * @param format general, fixed or scientific notation
+			 * @param precision -1 for round trip digits, otherwise 0 to 99
+			 * @return reference to this instance
+			 */
+			StringBuilder& AppendFormat(double value, FloatFormat format = FloatFormat::General, int precision = -1);
+			//! \sa Float::ToString(real)
+			StringBuilder& AppendFormat(real value);
+			//! remove collected content but keep first storage block
+			void Clear();
+			//! create string from collected content
+			String ToString() const;
+			StringBuilder& operator=(const StringBuilder&) = delete;
+			//! move content from given instance to this instance
+			StringBuilder& operator=(StringBuilder&&);
+		private:
+			/**
+			 * get contiguous free space within last storage block
+			 *
+			 * @param count required space without the null char
+			 * @return pointer to free space, which can hold count + 1 chars
+			 */
+			char* Prepare(int count);
+			/**
+			 * mark prepared chars as used
+			 *
+			 * @param count how many chars were written
+			 */
+			void Commit(int count);
+			//! append a new storage block, which can hold at least count chars
+			void AddChunk(int count);
+			//! free all storage blocks
+			void FreeChunks();
+			//! write formatted integer into last storage block
+			template <typename T>
+			StringBuilder& AppendNumber(T value, IntegerBase base);
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,240 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StringPool.hpp"
+#include "StringView.hpp"
+#include "String.hpp"
+#include "Hash.hpp"
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+#ifndef LUPUS_WINDOWS_PLATFORM
+#include <mutex>
+#endif
+
+using namespace Lupus::System;
+
+//! bits of the hash selecting a shard
+static const int sShardBits = 4;
+//! number of shards
+static const int sShardCount = 1 << sShardBits;
+//! initial number of buckets within a shard, power of two
+static const int sBucketCount = 64;
+
+//! entry of the empty string, never stored within a shard, the hash is HashChars("", 0)
+static InternEntry sEmptyEntry = { nullptr, 0x93228a4de0eec5a2ULL, 0, { '\0' } };
+
+//! part of the pool guarded by its own lock, all zero is a valid empty shard
+class InternShard
+{
+	//! chained buckets
+	InternEntry** _buckets;
+	//! number of buckets, power of two
+	int _capacity;
+	//! number of entries
+	int _count;
+
+	void Grow()
+	{
+		// variables
+		int capacity = (_capacity ? _capacity * 2 : sBucketCount);
+		InternEntry** buckets = new InternEntry*[capacity]();
+
+		// relink entries, hashes are stored so no chars are touched
+		for (int i = 0; i < _capacity; i++) {
+			InternEntry* entry = _buckets[i];
+
+			while (entry) {
+				InternEntry* next = entry->next;
+				InternEntry*& bucket = buckets[entry->hash & (capacity - 1)];
+				entry->next = bucket;
+				bucket = entry;
+				entry = next;
+			}
+		}
+
+		delete[] _buckets;
+		_buckets = buckets;
+		_capacity = capacity;
+	}
+public:
+	int Count() const
+	{
+		return _count;
+	}
+
+	InternEntry* Find(const char* data, int length, Lupus::ullong hash) const
+	{
+		// check state
+		if (!_capacity) {
+			return nullptr;
+		}
+
+		// compare hash and length first, chars only on a likely match
+		for (InternEntry* entry = _buckets[hash & (_capacity - 1)]; entry; entry = entry->next) {
+			if (entry->hash == hash && entry->length == length && !memcmp(entry->data, data, length)) {
+				return entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	InternEntry* Add(const char* data, int length, Lupus::ullong hash)
+	{
+		// check capacity, keep load factor below 3/4
+		if (_count >= _capacity - _capacity / 4) {
+			Grow();
+		}
+
+		// variables
+		void* memory = ::operator new(offsetof(InternEntry, data) + length + 1);
+		InternEntry* entry = static_cast<InternEntry*>(memory);
+		InternEntry*& bucket = _buckets[hash & (_capacity - 1)];
+
+		// fill and link entry
+		entry->hash = hash;
+		entry->length = length;
+		memcpy(entry->data, data, length);
+		entry->data[length] = '\0';
+		entry->next = bucket;
+		bucket = entry;
+		_count++;
+		return entry;
+	}
+};
+
+//! shards of the process wide pool, zero initialized before any constructor runs
+static InternShard sShards[sShardCount];
+
+// locks of the shards, constant initialized as well, so interning works during static initialization
+#ifdef LUPUS_WINDOWS_PLATFORM
+//! all zero equals SRWLOCK_INIT
+static SRWLOCK sLocks[sShardCount];
+#else
+//! std::mutex has a constexpr constructor
+static std::mutex sLocks[sShardCount];
+#endif
+
+//! holds the lock of a shard until leaving scope
+class ShardLock
+{
+	int _index;
+public:
+	ShardLock(int index) :
+		_index(index)
+	{
+#ifdef LUPUS_WINDOWS_PLATFORM
+		AcquireSRWLockExclusive(&sLocks[_index]);
+#else
+		sLocks[_index].lock();
+#endif
+	}
+
+	~ShardLock()
+	{
+#ifdef LUPUS_WINDOWS_PLATFORM
+		ReleaseSRWLockExclusive(&sLocks[_index]);
+#else
+		sLocks[_index].unlock();
+#endif
+	}
+};
+
+static int SelectShard(Lupus::ullong hash)
+{
+	// upper bits select the shard, lower bits select the bucket
+	return static_cast<int>(hash >> (64 - sShardBits));
+}
+
+namespace Lupus {
+	namespace System {
+		InternedString::InternedString() :
+			_entry(&sEmptyEntry)
+		{
+		}
+
+		StringView InternedString::View() const
+		{
+			return StringView(_entry->data, _entry->length);
+		}
+
+		String InternedString::ToString() const
+		{
+			return String(View());
+		}
+
+		InternedString StringPool::Intern(const StringView& string)
+		{
+			// check argument
+			if (string.IsEmpty()) {
+				return InternedString(&sEmptyEntry);
+			}
+
+			// variables
+			ullong hash = HashChars(string.Data(), string.Length());
+			int index = SelectShard(hash);
+			ShardLock lock(index);
+			InternEntry* entry = sShards[index].Find(string.Data(), string.Length(), hash);
+
+			// compute result
+			if (!entry) {
+				entry = sShards[index].Add(string.Data(), string.Length(), hash);
+			}
+
+			return InternedString(entry);
+		}
+
+		bool StringPool::TryGet(const StringView& string, InternedString& result)
+		{
+			// check argument
+			if (string.IsEmpty()) {
+				result = InternedString(&sEmptyEntry);
+				return true;
+			}
+
+			// variables
+			ullong hash = HashChars(string.Data(), string.Length());
+			int index = SelectShard(hash);
+			ShardLock lock(index);
+			InternEntry* entry = sShards[index].Find(string.Data(), string.Length(), hash);
+
+			// compute result
+			if (entry) {
+				result = InternedString(entry);
+			}
+
+			return (entry != nullptr);
+		}
+
+		int StringPool::Count()
+		{
+			// variables
+			int result = 0;
+
+			// compute result
+			for (int i = 0; i < sShardCount; i++) {
+				ShardLock lock(i);
+				result += sShards[i].Count();
+			}
+
+			return result;
+		}
+	}
+}
@@ -0,0 +1,121 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_STRINGPOOL_HPP
+#define LUPUS_STRINGPOOL_HPP
+
+#include "Types.hpp"
+
+namespace Lupus {
+	namespace System {
+		// declarations
+		class String;
+		class StringView;
+
+		//! pooled chars, allocated together with its header and never freed
+		struct InternEntry
+		{
+			//! next entry within the same bucket
+			InternEntry* next;
+			//! content hash
+			ullong hash;
+			//! number of chars
+			int length;
+			//! null terminated chars
+			char data[1];
+		};
+
+		/**
+		 * handle onto the single pooled copy of some chars
+		 *
+		 * consists only of a pointer into the string pool, so handles are copied, compared and
+		 * hashed without touching the chars. two handles are equal exactly if they were interned
+		 * from equal chars. pooled chars are null terminated and live until the process ends.
+		 */
+		class LUPUS_API InternedString
+		{
+			friend class StringPool;
+
+			//! pooled entry
+			const InternEntry* _entry;
+
+			InternedString(const InternEntry* entry);
+		public:
+			//! Create a handle onto the empty string, equal to interning an empty string
+			InternedString();
+			//! Return pooled chars, null terminated
+			const char* Data() const;
+			//! Return number of pooled chars
+			int Length() const;
+			//! Check if the pooled chars are empty
+			bool IsEmpty() const;
+			/**
+			 * Return the hash code computed while interning
+			 *
+			 * equal to the hash code of a view or string with the same content
+			 *
+			 * @return hash code
+			 */
+			ulong GetHashCode() const;
+			//! Create a view onto the pooled chars
+			StringView View() const;
+			/**
+			 * Copy the pooled chars into a new string
+			 *
+			 * @return new string
+			 */
+			String ToString() const;
+			//! Compare two handles by identity
+			bool operator==(const InternedString& string) const;
+			//! Compare two handles by identity
+			bool operator!=(const InternedString& string) const;
+		};
+
+		/**
+		 * process wide table storing every interned content once
+		 *
+		 * the table is split into shards selected by the content hash. each shard has its own
+		 * lock, so concurrent interning of different contents rarely waits on each other.
+		 */
+		class LUPUS_API StringPool
+		{
+		public:
+			/**
+			 * Return the handle for given chars, adding a copy to the pool if required
+			 *
+			 * @param string chars to be interned
+			 * @return handle equal to every other handle interned from the same chars
+			 */
+			static InternedString Intern(const StringView& string);
+			/**
+			 * Search the pool for given chars without adding them
+			 *
+			 * @param string chars to search for
+			 * @param result receives the handle if the chars were found
+			 * @return true if the chars were interned before
+			 */
+			static bool TryGet(const StringView& string, InternedString& result);
+			//! Return the number of distinct contents within the pool
+			static int Count();
+		};
+	}
+}
+
+#include "StringPool.inl"
+
+#endif
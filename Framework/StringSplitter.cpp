@@ -0,0 +1,179 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StringSplitter.hpp"
+#include "Exception.hpp"
+#include "Simd.hpp"
+#include <utility>
+
+namespace Lupus {
+	namespace System {
+		StringSplitter::StringSplitter(const StringView& text, const CharSet& delimiter, int count, StringSplitOptions options) :
+			_text(text),
+			_chars(delimiter),
+			_pattern(nullptr),
+			_ownedPattern(nullptr),
+			_count(count),
+			_options(options)
+		{
+			// check argument
+			if (count < 0) {
+				throw ArgumentOutOfRangeException("count is negativ");
+			}
+		}
+
+		StringSplitter::StringSplitter(const StringView& text, const CompiledPattern& delimiter, int count, StringSplitOptions options) :
+			_text(text),
+			_pattern(&delimiter),
+			_ownedPattern(nullptr),
+			_count(count),
+			_options(options)
+		{
+			// check argument
+			if (count < 0) {
+				throw ArgumentOutOfRangeException("count is negativ");
+			}
+		}
+
+		StringSplitter::StringSplitter(const StringView& text, Pointer<CompiledPattern>&& delimiter, int count, StringSplitOptions options) :
+			_text(text),
+			_pattern(nullptr),
+			_ownedPattern(std::move(delimiter)),
+			_count(count),
+			_options(options)
+		{
+			// check argument
+			if (count < 0) {
+				throw ArgumentOutOfRangeException("count is negativ");
+			}
+
+			_pattern = &*_ownedPattern;
+		}
+
+		StringSplitter::StringSplitter(StringSplitter&& splitter) :
+			_text(splitter._text),
+			_chars(splitter._chars),
+			_pattern(splitter._pattern),
+			_ownedPattern(std::move(splitter._ownedPattern)),
+			_count(splitter._count),
+			_options(splitter._options)
+		{
+		}
+
+		StringSplitter::~StringSplitter()
+		{
+		}
+
+		Pointer<Iterator<StringView>> StringSplitter::GetIterator() const
+		{
+			return Pointer<Iterator<StringView>>(new StringSplitIterator(this));
+		}
+
+		int StringSplitter::Find(int startIndex, int& length) const
+		{
+			// variables
+			const char* text = _text.Data() + startIndex;
+			int textLength = _text.Length() - startIndex;
+			int result = -1;
+
+			// compute result, an empty pattern never matches
+			if (!_pattern) {
+				length = 1;
+				result = FindAnyChar(text, textLength, _chars);
+			} else if ((length = _pattern->Length) > 0) {
+				result = _pattern->Search(text, textLength);
+			}
+
+			return (result == -1 ? -1 : (startIndex + result));
+		}
+
+		StringSplitter::StringSplitIterator::StringSplitIterator(const StringSplitter* splitter) :
+			_splitter(splitter)
+		{
+			if (!splitter) {
+				throw ArgumentNullException();
+			}
+
+			First();
+		}
+
+		StringSplitter::StringSplitIterator::~StringSplitIterator()
+		{
+		}
+
+		void StringSplitter::StringSplitIterator::First()
+		{
+			_position = 0;
+			_tokens = 0;
+			_last = false;
+			_done = false;
+			Next();
+		}
+
+		void StringSplitter::StringSplitIterator::Next()
+		{
+			// variables
+			const StringView& text = _splitter->_text;
+			bool keepEmpty = (_splitter->_options == StringSplitOptions::None);
+			int length = 0;
+			int index = 0;
+
+			// remaining text was already returned or no token is allowed
+			if (_last || _splitter->_count == 0) {
+				_done = true;
+				return;
+			}
+
+			// next token up to a delimiter
+			while (_tokens < _splitter->_count - 1 && (index = _splitter->Find(_position, length)) != -1) {
+				int startIndex = _position;
+				_position = index + length;
+
+				if (keepEmpty || index != startIndex) {
+					_current = text.Substring(startIndex, index - startIndex);
+					_tokens++;
+					return;
+				}
+			}
+
+			// last token holds the remaining text
+			_last = true;
+
+			if (keepEmpty || _position != text.Length()) {
+				_current = text.Substring(_position);
+				_tokens++;
+			} else {
+				_done = true;
+			}
+		}
+
+		bool StringSplitter::StringSplitIterator::IsDone() const
+		{
+			return _done;
+		}
+
+		const StringView& StringSplitter::StringSplitIterator::CurrentItem() const
+		{
+			if (IsDone()) {
+				throw IteratorOutOfBoundException();
+			}
+
+			return _current;
+		}
+	}
+}
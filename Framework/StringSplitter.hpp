@@ -0,0 +1,138 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_STRINGSPLITTER_HPP
+#define LUPUS_STRINGSPLITTER_HPP
+
+#include "Types.hpp"
+#include "Iterator.hpp"
+#include "String.hpp"
+#include "StringView.hpp"
+#include "CharSet.hpp"
+
+namespace Lupus {
+	namespace System {
+		/**
+		 * lazy split of a text, yields the tokens as views while iterating
+		 *
+		 * tokens are searched only when the iterator advances, so stopping early skips the
+		 * rest of the text and no token is ever copied. the text and a compiled pattern passed
+		 * by reference have to outlive the splitter.
+		 */
+		class LUPUS_API StringSplitter : public Iterable<StringView>
+		{
+			//! split text
+			StringView _text;
+			//! delimiter chars, used if there is no pattern
+			CharSet _chars;
+			//! compiled delimiter string or nullptr
+			const CompiledPattern* _pattern;
+			//! owned compiled delimiter string
+			Pointer<CompiledPattern> _ownedPattern;
+			//! maximum number of tokens
+			int _count;
+			//! split flag
+			StringSplitOptions _options;
+		public:
+			/**
+			 * Split a text at any of given chars
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param text text to split
+			 * @param delimiter delimiter chars
+			 * @param count maximum number of tokens, the last token holds the remaining text
+			 * @param options split flag
+			 */
+			StringSplitter(const StringView& text, const CharSet& delimiter, int count, StringSplitOptions options = StringSplitOptions::None);
+			/**
+			 * Split a text at every match of a compiled pattern, an empty pattern never matches
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param text text to split
+			 * @param delimiter compiled delimiter string, not owned
+			 * @param count maximum number of tokens, the last token holds the remaining text
+			 * @param options split flag
+			 */
+			StringSplitter(const StringView& text, const CompiledPattern& delimiter, int count, StringSplitOptions options = StringSplitOptions::None);
+			/**
+			 * Split a text at every match of a compiled pattern, an empty pattern never matches
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 * - NullPointerException
+			 *
+			 * @param text text to split
+			 * @param delimiter compiled delimiter string, owned by this instance
+			 * @param count maximum number of tokens, the last token holds the remaining text
+			 * @param options split flag
+			 */
+			StringSplitter(const StringView& text, Pointer<CompiledPattern>&& delimiter, int count, StringSplitOptions options = StringSplitOptions::None);
+			StringSplitter(const StringSplitter&) = delete;
+			//! Move splitter from given instance to this instance
+			StringSplitter(StringSplitter&& splitter);
+			//! Destructor
+			virtual ~StringSplitter();
+			//! \sa Iterable::GetIterator
+			virtual Pointer<Iterator<StringView>> GetIterator() const override;
+			StringSplitter& operator=(const StringSplitter&) = delete;
+			StringSplitter& operator=(StringSplitter&&) = delete;
+		private:
+			/**
+			 * search next delimiter without argument checks
+			 *
+			 * @param startIndex index within the text to start searching at
+			 * @param length receives the delimiter length
+			 * @return index of next delimiter or -1
+			 */
+			int Find(int startIndex, int& length) const;
+			class StringSplitIterator : public Iterator<StringView>
+			{
+				//! iterated splitter
+				const StringSplitter* _splitter;
+				//! current token
+				StringView _current;
+				//! start of the remaining text
+				int _position;
+				//! number of tokens returned so far
+				int _tokens;
+				//! remaining text was returned
+				bool _last;
+				//! no more tokens
+				bool _done;
+			public:
+				StringSplitIterator() = delete;
+				StringSplitIterator(const StringSplitIterator&) = delete;
+				StringSplitIterator(StringSplitIterator&&) = delete;
+				StringSplitIterator(const StringSplitter*);
+				virtual ~StringSplitIterator();
+				virtual void First() override;
+				virtual void Next() override;
+				virtual bool IsDone() const override;
+				virtual const StringView& CurrentItem() const override;
+				StringSplitIterator& operator=(const StringSplitIterator&) = delete;
+				StringSplitIterator& operator=(StringSplitIterator&&) = delete;
+			};
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,166 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StringView.hpp"
+#include "String.hpp"
+#include "Exception.hpp"
+#include "Simd.hpp"
+#include "Hash.hpp"
+#include <cstring>
+
+namespace Lupus {
+	namespace System {
+		StringView::StringView(const char* str) :
+			_data(str),
+			_length(0)
+		{
+			// check argument
+			if (!str) {
+				throw ArgumentNullException("str must have a valid value");
+			}
+
+			_length = strlen(str);
+		}
+
+		StringView::StringView(const char* str, int count) :
+			_data(str),
+			_length(count)
+		{
+			// check arguments
+			if (!str) {
+				throw ArgumentNullException("str must have a valid value");
+			} else if (count < 0) {
+				throw ArgumentOutOfRangeException("count must be greater than or equal to zero");
+			}
+		}
+
+		StringView::StringView(const String& string) :
+			_data(string._data),
+			_length(string._length)
+		{
+		}
+
+		int StringView::Compare(const StringView& view, CaseSensitivity sensitivity) const
+		{
+			// check length
+			if (_length != view._length) {
+				return (_length - view._length);
+			}
+
+			return CompareChars(_data, view._data, _length, sensitivity);
+		}
+
+		int StringView::CompareLocale(const StringView& view) const
+		{
+			// check length
+			if (_length != view._length) {
+				return (_length - view._length);
+			}
+
+			return CompareCharsLocale(_data, view._data, _length);
+		}
+
+		bool StringView::Contains(const StringView& view, CaseSensitivity sensitivity) const
+		{
+			return (IndexOf(view, 0, sensitivity) != -1);
+		}
+
+		int StringView::IndexOf(const StringView& view, int startIndex, CaseSensitivity sensitivity) const
+		{
+			// check arguments
+			if (startIndex > _length) {
+				throw ArgumentOutOfRangeException("startIndex exceeds view length");
+			} else if (startIndex < 0) {
+				throw ArgumentOutOfRangeException("startIndex must be greater than or equal to zero");
+			}
+
+			// search pattern doesn't fit into remaining view
+			if (view._length > (_length - startIndex)) {
+				return -1;
+			} else if (view._length == 0) {
+				return startIndex;
+			}
+
+			// compute result
+			int result = String::_defaultStrategy->Search(_data + startIndex, _length - startIndex, view._data, view._length, sensitivity);
+
+			return (result == -1 ? -1 : (startIndex + result));
+		}
+
+		ulong StringView::GetHashCode(CaseSensitivity sensitivity) const
+		{
+			// variables
+			ullong hash = HashChars(_data, _length, sensitivity);
+
+			return static_cast<ulong>(hash ^ (hash >> 32));
+		}
+
+		StringView StringView::Substring(int startIndex) const
+		{
+			// check arguments
+			if (startIndex > _length) {
+				throw ArgumentOutOfRangeException("startIndex exceeds view length");
+			} else if (startIndex < 0) {
+				throw ArgumentOutOfRangeException("startIndex must be greater than or equal to zero");
+			}
+
+			return StringView(_data + startIndex, _length - startIndex);
+		}
+
+		StringView StringView::Substring(int startIndex, int count) const
+		{
+			// check arguments
+			if (startIndex < 0) {
+				throw ArgumentOutOfRangeException("startIndex must be greater than or equal to zero");
+			} else if (count < 0) {
+				throw ArgumentOutOfRangeException("count must be greater than or equal to zero");
+			} else if (startIndex > (_length - count)) {
+				throw ArgumentOutOfRangeException("startIndex plus count exceeds view length");
+			}
+
+			return StringView(_data + startIndex, count);
+		}
+
+		String StringView::ToString() const
+		{
+			return String(*this);
+		}
+
+		const char& StringView::operator[](int index) const
+		{
+			// check argument
+			if (index >= _length) {
+				throw ArgumentOutOfRangeException("index exceeds view length");
+			} else if (index < 0) {
+				throw ArgumentOutOfRangeException("index must be greater than or equal to zero");
+			}
+
+			return _data[index];
+		}
+
+		bool StringView::operator==(const StringView& view) const
+		{
+			return (_length == view._length && memcmp(_data, view._data, _length) == 0);
+		}
+
+		bool StringView::operator!=(const StringView& view) const
+		{
+			return !(*this == view);
+		}
+	}
+}
@@ -0,0 +1,172 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_STRINGVIEW_HPP
+#define LUPUS_STRINGVIEW_HPP
+
+#include "Types.hpp"
+
+namespace Lupus {
+	namespace System {
+		// declarations
+		class String;
+
+		/**
+		 * non owning view onto a range of chars
+		 *
+		 * consists only of a pointer and a length, so creating, copying and slicing a view
+		 * never allocates. the viewed chars aren't required to be null terminated and have
+		 * to outlive the view.
+		 */
+		class LUPUS_API StringView
+		{
+			//! first viewed char
+			const char* _data;
+			//! number of viewed chars
+			int _length;
+		public:
+			//! Create an empty view
+			StringView();
+			/**
+			 * Create a view onto a null terminated native string
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 *
+			 * @param str native string
+			 */
+			StringView(const char* str);
+			/**
+			 * Create a view onto count chars of a native string
+			 *
+			 * \b Exceptions
+			 * - ArgumentNullException
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param str native string, doesn't need to be null terminated
+			 * @param count number of viewed chars
+			 */
+			StringView(const char* str, int count);
+			/**
+			 * Create a view onto the whole content of a string
+			 *
+			 * the view is invalidated by any modification of the string
+			 *
+			 * @param string viewed string
+			 */
+			StringView(const String& string);
+			//! Return first viewed char, not null terminated
+			const char* Data() const;
+			//! Return number of viewed chars
+			int Length() const;
+			//! Check if this view is empty
+			bool IsEmpty() const;
+			/**
+			 * Compare two views and return there difference
+			 *
+			 * shorter views are ordered first. case insensitive comparison folds ascii letters only
+			 * and orders by the folded chars, so it's consistent with equality.
+			 *
+			 * @param view view to be compared to this instance
+			 * @param sensitivity flag for case sensitivity
+			 * @return zero if the two views are equal, else the difference at the first deviation
+			 */
+			int Compare(const StringView& view, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Compare two views case insensitive with tolower of the current locale
+			 *
+			 * slower than Compare, only required for letters beyond ascii
+			 *
+			 * @param view view to be compared to this instance
+			 * @return zero if the two views are equal, else the difference at the first deviation
+			 */
+			int CompareLocale(const StringView& view) const;
+			/**
+			 * Check if this view contains a specific value
+			 *
+			 * @param view chars to be checked
+			 * @param sensitivity flag for case sensitivity
+			 * @return true if this view contains given chars
+			 */
+			bool Contains(const StringView& view, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Search for given chars within this view with the default text search algorithm
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param view chars to search for
+			 * @param startIndex at what index begins the search for this view
+			 * @param sensitivity defines the case sensitivity for search process
+			 * @return index of first match or -1 if no such chars were found
+			 */
+			int IndexOf(const StringView& view, int startIndex = 0, CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Compute a hash code from the viewed chars
+			 *
+			 * equal to the hash code of a string with the same content
+			 *
+			 * @param sensitivity flag for case sensitivity
+			 * @return hash code
+			 */
+			ulong GetHashCode(CaseSensitivity sensitivity = CaseSensitivity::CaseSensitive) const;
+			/**
+			 * Create a view starting at given index
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param startIndex starting index within this view
+			 * @return view onto the remaining chars
+			 */
+			StringView Substring(int startIndex) const;
+			/**
+			 * Create a view onto count chars starting at given index
+			 *
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @param startIndex starting index within this view
+			 * @param count number of viewed chars
+			 * @return view onto given range
+			 */
+			StringView Substring(int startIndex, int count) const;
+			/**
+			 * Copy the viewed chars into a new string
+			 *
+			 * @return new string
+			 */
+			String ToString() const;
+			/**
+			 * \b Exceptions
+			 * - ArgumentOutOfRangeException
+			 *
+			 * @return char at given index
+			 */
+			const char& operator[](int index) const;
+			//! Compare two views char by char
+			bool operator==(const StringView& view) const;
+			//! Compare two views char by char
+			bool operator!=(const StringView& view) const;
+		};
+	}
+}
+
+#include "StringView.inl"
+
+#endif
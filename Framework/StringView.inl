@@ -0,0 +1,42 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+namespace Lupus {
+	namespace System {
+		inline StringView::StringView() :
+			_data(""),
+			_length(0)
+		{
+		}
+
+		inline const char* StringView::Data() const
+		{
+			return _data;
+		}
+
+		inline int StringView::Length() const
+		{
+			return _length;
+		}
+
+		inline bool StringView::IsEmpty() const
+		{
+			return (_length == 0);
+		}
+	}
+}
@@ -0,0 +1,562 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TextSearch.hpp"
+#include "Simd.hpp"
+#include <cstring>
+
+//! patterns shorter than this are searched with simd search by the adaptive strategy
+static const int sShortPatternLength = 4;
+//! patterns with at most this many distinct chars are searched with two-way by the adaptive strategy
+static const int sSmallAlphabetSize = 4;
+
+namespace {
+	//! compares chars as they are
+	struct SensitiveKey
+	{
+		static unsigned char Get(char ch)
+		{
+			return static_cast<unsigned char>(ch);
+		}
+	};
+
+	//! compares chars by their ascii lower case equivalent
+	struct InsensitiveKey
+	{
+		static unsigned char Get(char ch)
+		{
+			return Lupus::System::AsciiLowerTable[static_cast<unsigned char>(ch)];
+		}
+	};
+
+	//! critical factorization of a pattern used by two-way
+	struct Factorization
+	{
+		//! end of the left part
+		int suffix;
+		//! shift after a mismatch in the left part
+		int period;
+		//! left part repeats with period
+		bool periodic;
+	};
+
+	template <typename Key>
+	bool Equals(const char* lhs, const char* rhs, int count)
+	{
+		for (int i = 0; i < count; i++) {
+			if (Key::Get(lhs[i]) != Key::Get(rhs[i])) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename Key>
+	void BuildPrefix(const char* search, int searchLength, int* prefix)
+	{
+		// variables
+		int i = 0;
+		int j = -1;
+
+		// create prefix
+		prefix[0] = -1;
+
+		while (i < searchLength) {
+			while (j >= 0 && Key::Get(search[i]) != Key::Get(search[j])) {
+				j = prefix[j];
+			}
+			i++;
+			j++;
+			prefix[i] = j;
+		}
+	}
+
+	template <typename Key>
+	int PrefixSearch(const char* text, int textLength, const char* search, int searchLength, const int* prefix)
+	{
+		// variables
+		int i = 0;
+		int j = 0;
+
+		// search
+		while (i < textLength) {
+			while (j >= 0 && Key::Get(text[i]) != Key::Get(search[j])) {
+				j = prefix[j];
+			}
+			i++;
+			j++;
+
+			if (j == searchLength) {
+				return (i - j);
+			}
+		}
+
+		return -1;
+	}
+
+	template <typename Key>
+	void BuildShift(const char* search, int searchLength, int* shift)
+	{
+		// variables
+		int last = searchLength - 1;
+
+		// create bad character table
+		for (int i = 0; i < 256; i++) {
+			shift[i] = searchLength;
+		}
+
+		for (int i = 0; i < last; i++) {
+			shift[Key::Get(search[i])] = last - i;
+		}
+	}
+
+	template <typename Key>
+	int HorspoolSearch(const char* text, int textLength, const char* search, int searchLength, const int* shift)
+	{
+		// variables
+		int last = searchLength - 1;
+		unsigned char lastKey = Key::Get(search[last]);
+		int limit = textLength - searchLength;
+
+		// search
+		for (int i = 0; i <= limit; ) {
+			unsigned char key = Key::Get(text[i + last]);
+
+			if (key == lastKey && Equals<Key>(text + i, search, last)) {
+				return i;
+			}
+
+			i += shift[key];
+		}
+
+		return -1;
+	}
+
+	template <typename Key>
+	int MaximalSuffix(const char* search, int searchLength, int& period, bool reversed)
+	{
+		// variables
+		int suffix = -1;
+		int j = 0;
+		int k = 1;
+		int p = 1;
+
+		// compute maximal suffix in respect of given ordering
+		while (j + k < searchLength) {
+			unsigned char a = Key::Get(search[j + k]);
+			unsigned char b = Key::Get(search[suffix + k]);
+
+			if (reversed ? (a > b) : (a < b)) {
+				j += k;
+				k = 1;
+				p = j - suffix;
+			} else if (a == b) {
+				if (k != p) {
+					k++;
+				} else {
+					j += p;
+					k = 1;
+				}
+			} else {
+				suffix = j;
+				j = suffix + 1;
+				k = p = 1;
+			}
+		}
+
+		period = p;
+		return suffix;
+	}
+
+	template <typename Key>
+	Factorization Factorize(const char* search, int searchLength)
+	{
+		// variables
+		Factorization result;
+		int reversedPeriod = 0;
+		int reversedSuffix = MaximalSuffix<Key>(search, searchLength, reversedPeriod, true);
+
+		// critical factorization
+		result.suffix = MaximalSuffix<Key>(search, searchLength, result.period, false);
+
+		if (result.suffix < reversedSuffix) {
+			result.suffix = reversedSuffix;
+			result.period = reversedPeriod;
+		}
+
+		result.periodic = Equals<Key>(search, search + result.period, result.suffix + 1);
+
+		if (!result.periodic) {
+			result.period = ((result.suffix + 1 > searchLength - result.suffix - 1) ? (result.suffix + 1) : (searchLength - result.suffix - 1)) + 1;
+		}
+
+		return result;
+	}
+
+	template <typename Key>
+	int TwoWaySearch(const char* text, int textLength, const char* search, int searchLength, const Factorization& factorization)
+	{
+		// variables
+		int suffix = factorization.suffix;
+		int period = factorization.period;
+		int limit = textLength - searchLength;
+
+		if (factorization.periodic) {
+			// periodic pattern, remember already matched prefix
+			int memory = -1;
+
+			for (int j = 0; j <= limit; ) {
+				int i = ((suffix > memory) ? suffix : memory) + 1;
+
+				// match right part
+				while (i < searchLength && Key::Get(search[i]) == Key::Get(text[i + j])) {
+					i++;
+				}
+
+				if (i < searchLength) {
+					j += i - suffix;
+					memory = -1;
+					continue;
+				}
+
+				// match left part
+				i = suffix;
+
+				while (i > memory && Key::Get(search[i]) == Key::Get(text[i + j])) {
+					i--;
+				}
+
+				if (i <= memory) {
+					return j;
+				}
+
+				j += period;
+				memory = searchLength - period - 1;
+			}
+		} else {
+			// non periodic pattern
+			for (int j = 0; j <= limit; ) {
+				int i = suffix + 1;
+
+				// match right part
+				while (i < searchLength && Key::Get(search[i]) == Key::Get(text[i + j])) {
+					i++;
+				}
+
+				if (i < searchLength) {
+					j += i - suffix;
+					continue;
+				}
+
+				// match left part
+				i = suffix;
+
+				while (i >= 0 && Key::Get(search[i]) == Key::Get(text[i + j])) {
+					i--;
+				}
+
+				if (i < 0) {
+					return j;
+				}
+
+				j += period;
+			}
+		}
+
+		return -1;
+	}
+
+	template <typename Key>
+	int CountDistinct(const char* search, int searchLength, int limit)
+	{
+		// variables
+		bool seen[256] = { false };
+		int result = 0;
+
+		// stop counting as soon as limit is exceeded
+		for (int i = 0; i < searchLength && result <= limit; i++) {
+			unsigned char key = Key::Get(search[i]);
+
+			if (!seen[key]) {
+				seen[key] = true;
+				result++;
+			}
+		}
+
+		return result;
+	}
+
+	template <typename Key>
+	int AdaptiveSearch(const char* text, int textLength, const char* search, int searchLength)
+	{
+		if (CountDistinct<Key>(search, searchLength, sSmallAlphabetSize) <= sSmallAlphabetSize) {
+			return TwoWaySearch<Key>(text, textLength, search, searchLength, Factorize<Key>(search, searchLength));
+		}
+
+		// variables
+		int shift[256];
+
+		// compute result
+		BuildShift<Key>(search, searchLength, shift);
+		return HorspoolSearch<Key>(text, textLength, search, searchLength, shift);
+	}
+
+	//! knuth-morris-pratt pattern with prefix table
+	template <typename Key>
+	class PrefixPattern : public Lupus::System::CompiledPattern
+	{
+		int* _prefix;
+	public:
+		PrefixPattern(const char* search, int searchLength, Lupus::System::CaseSensitivity sensitivity) :
+			CompiledPattern(search, searchLength, sensitivity),
+			_prefix(new int[searchLength + 1])
+		{
+			BuildPrefix<Key>(_pattern, _length, _prefix);
+		}
+
+		virtual ~PrefixPattern()
+		{
+			delete[] _prefix;
+		}
+	protected:
+		virtual int Match(const char* text, int textLength) const override
+		{
+			return PrefixSearch<Key>(text, textLength, _pattern, _length, _prefix);
+		}
+	};
+
+	//! boyer-moore-horspool pattern with bad character table
+	template <typename Key>
+	class HorspoolPattern : public Lupus::System::CompiledPattern
+	{
+		int _shift[256];
+	public:
+		HorspoolPattern(const char* search, int searchLength, Lupus::System::CaseSensitivity sensitivity) :
+			CompiledPattern(search, searchLength, sensitivity)
+		{
+			BuildShift<Key>(_pattern, _length, _shift);
+		}
+	protected:
+		virtual int Match(const char* text, int textLength) const override
+		{
+			return HorspoolSearch<Key>(text, textLength, _pattern, _length, _shift);
+		}
+	};
+
+	//! two-way pattern with critical factorization
+	template <typename Key>
+	class TwoWayPattern : public Lupus::System::CompiledPattern
+	{
+		Factorization _factorization;
+	public:
+		TwoWayPattern(const char* search, int searchLength, Lupus::System::CaseSensitivity sensitivity) :
+			CompiledPattern(search, searchLength, sensitivity),
+			_factorization(Factorize<Key>(search, searchLength))
+		{
+		}
+	protected:
+		virtual int Match(const char* text, int textLength) const override
+		{
+			return TwoWaySearch<Key>(text, textLength, _pattern, _length, _factorization);
+		}
+	};
+
+	template <template <typename> class Pattern>
+	Lupus::Pointer<Lupus::System::CompiledPattern> CompilePattern(const Lupus::System::String& pattern, Lupus::System::CaseSensitivity sensitivity)
+	{
+		switch (sensitivity) {
+		case Lupus::System::CaseSensitivity::CaseInsensitive:
+			return new Pattern<InsensitiveKey>(pattern.Data, pattern.Length, sensitivity);
+		default:
+			return new Pattern<SensitiveKey>(pattern.Data, pattern.Length, sensitivity);
+		}
+	}
+}
+
+namespace Lupus {
+	namespace System {
+		Pointer<ITextSearchStrategy> KnuthMorrisPratt::Copy() const
+		{
+			return new KnuthMorrisPratt();
+		}
+
+		int KnuthMorrisPratt::Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const
+		{
+			// check arguments
+			if (searchLength <= 0) {
+				return 0;
+			} else if (searchLength > textLength) {
+				return -1;
+			}
+
+			// variables
+			int* prefix = new int[searchLength + 1];
+			int result = -1;
+
+			// compute result
+			switch (sensitivity) {
+			case CaseSensitivity::CaseSensitive:
+				BuildPrefix<SensitiveKey>(search, searchLength, prefix);
+				result = PrefixSearch<SensitiveKey>(text, textLength, search, searchLength, prefix);
+				break;
+			case CaseSensitivity::CaseInsensitive:
+				BuildPrefix<InsensitiveKey>(search, searchLength, prefix);
+				result = PrefixSearch<InsensitiveKey>(text, textLength, search, searchLength, prefix);
+				break;
+			}
+
+			delete[] prefix;
+			return result;
+		}
+
+		Pointer<CompiledPattern> KnuthMorrisPratt::Compile(const String& pattern, CaseSensitivity sensitivity) const
+		{
+			return CompilePattern<PrefixPattern>(pattern, sensitivity);
+		}
+
+		Pointer<ITextSearchStrategy> BoyerMooreHorspool::Copy() const
+		{
+			return new BoyerMooreHorspool();
+		}
+
+		int BoyerMooreHorspool::Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const
+		{
+			// check arguments
+			if (searchLength <= 0) {
+				return 0;
+			} else if (searchLength > textLength) {
+				return -1;
+			}
+
+			// variables
+			int shift[256];
+
+			// compute result
+			switch (sensitivity) {
+			case CaseSensitivity::CaseSensitive:
+				BuildShift<SensitiveKey>(search, searchLength, shift);
+				return HorspoolSearch<SensitiveKey>(text, textLength, search, searchLength, shift);
+			case CaseSensitivity::CaseInsensitive:
+				BuildShift<InsensitiveKey>(search, searchLength, shift);
+				return HorspoolSearch<InsensitiveKey>(text, textLength, search, searchLength, shift);
+			}
+
+			return -1;
+		}
+
+		Pointer<CompiledPattern> BoyerMooreHorspool::Compile(const String& pattern, CaseSensitivity sensitivity) const
+		{
+			return CompilePattern<HorspoolPattern>(pattern, sensitivity);
+		}
+
+		Pointer<ITextSearchStrategy> TwoWay::Copy() const
+		{
+			return new TwoWay();
+		}
+
+		int TwoWay::Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const
+		{
+			// check arguments
+			if (searchLength <= 0) {
+				return 0;
+			} else if (searchLength > textLength) {
+				return -1;
+			}
+
+			switch (sensitivity) {
+			case CaseSensitivity::CaseSensitive:
+				return TwoWaySearch<SensitiveKey>(text, textLength, search, searchLength, Factorize<SensitiveKey>(search, searchLength));
+			case CaseSensitivity::CaseInsensitive:
+				return TwoWaySearch<InsensitiveKey>(text, textLength, search, searchLength, Factorize<InsensitiveKey>(search, searchLength));
+			}
+
+			return -1;
+		}
+
+		Pointer<CompiledPattern> TwoWay::Compile(const String& pattern, CaseSensitivity sensitivity) const
+		{
+			return CompilePattern<TwoWayPattern>(pattern, sensitivity);
+		}
+
+		Pointer<ITextSearchStrategy> SimdSearch::Copy() const
+		{
+			return new SimdSearch();
+		}
+
+		int SimdSearch::Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const
+		{
+			return FindString(text, textLength, search, searchLength, sensitivity);
+		}
+
+		Pointer<ITextSearchStrategy> AdaptiveSearch::Copy() const
+		{
+			return new AdaptiveSearch();
+		}
+
+		int AdaptiveSearch::Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const
+		{
+			// check arguments
+			if (searchLength <= 0) {
+				return 0;
+			} else if (searchLength > textLength) {
+				return -1;
+			} else if (searchLength < sShortPatternLength) {
+				return FindString(text, textLength, search, searchLength, sensitivity);
+			}
+
+			switch (sensitivity) {
+			case CaseSensitivity::CaseSensitive:
+				return ::AdaptiveSearch<SensitiveKey>(text, textLength, search, searchLength);
+			case CaseSensitivity::CaseInsensitive:
+				return ::AdaptiveSearch<InsensitiveKey>(text, textLength, search, searchLength);
+			}
+
+			return -1;
+		}
+
+		Pointer<CompiledPattern> AdaptiveSearch::Compile(const String& pattern, CaseSensitivity sensitivity) const
+		{
+			// variables
+			const char* search = pattern.Data;
+			int searchLength = pattern.Length;
+			int distinct = 0;
+
+			// short patterns have nothing worth preprocessing
+			if (searchLength < sShortPatternLength) {
+				return ITextSearchStrategy::Compile(pattern, sensitivity);
+			}
+
+			// select algorithm once for the pattern
+			switch (sensitivity) {
+			case CaseSensitivity::CaseSensitive:
+				distinct = CountDistinct<SensitiveKey>(search, searchLength, sSmallAlphabetSize);
+				break;
+			case CaseSensitivity::CaseInsensitive:
+				distinct = CountDistinct<InsensitiveKey>(search, searchLength, sSmallAlphabetSize);
+				break;
+			}
+
+			if (distinct <= sSmallAlphabetSize) {
+				return CompilePattern<TwoWayPattern>(pattern, sensitivity);
+			}
+
+			return CompilePattern<HorspoolPattern>(pattern, sensitivity);
+		}
+	}
+}
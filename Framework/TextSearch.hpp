@@ -0,0 +1,96 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LUPUS_TEXTSEARCH_HPP
+#define LUPUS_TEXTSEARCH_HPP
+
+#include "String.hpp"
+
+namespace Lupus {
+	namespace System {
+		/**
+		 * implements boyer-moore-horspool text search algorithm
+		 *
+		 * skips up to the pattern length per step, best suited for long patterns over large alphabets
+		 */
+		class LUPUS_API BoyerMooreHorspool : public ITextSearchStrategy
+		{
+		public:
+			using ITextSearchStrategy::Search;
+			//! \sa ICopyable::Copy
+			virtual Pointer<ITextSearchStrategy> Copy() const override;
+			//! \sa TextSearchStrategy::Search
+			virtual int Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const override;
+			//! \sa TextSearchStrategy::Compile
+			virtual Pointer<CompiledPattern> Compile(const String& pattern, CaseSensitivity sensitivity) const override;
+		};
+
+		/**
+		 * implements crochemore-perrin two-way text search algorithm
+		 *
+		 * linear worst case with constant extra space, robust for periodic patterns and small alphabets
+		 */
+		class LUPUS_API TwoWay : public ITextSearchStrategy
+		{
+		public:
+			using ITextSearchStrategy::Search;
+			//! \sa ICopyable::Copy
+			virtual Pointer<ITextSearchStrategy> Copy() const override;
+			//! \sa TextSearchStrategy::Search
+			virtual int Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const override;
+			//! \sa TextSearchStrategy::Compile
+			virtual Pointer<CompiledPattern> Compile(const String& pattern, CaseSensitivity sensitivity) const override;
+		};
+
+		/**
+		 * implements block filtered text search
+		 *
+		 * compares first and last pattern char against 16 or 32 text positions at once using
+		 * sse2 or avx2, selected at runtime. fastest for short patterns and rare first chars.
+		 */
+		class LUPUS_API SimdSearch : public ITextSearchStrategy
+		{
+		public:
+			using ITextSearchStrategy::Search;
+			//! \sa ICopyable::Copy
+			virtual Pointer<ITextSearchStrategy> Copy() const override;
+			//! \sa TextSearchStrategy::Search
+			virtual int Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const override;
+		};
+
+		/**
+		 * selects a text search algorithm for every search
+		 *
+		 * short patterns are searched with simd search, patterns with few distinct chars use two-way
+		 * and all other patterns use boyer-moore-horspool
+		 */
+		class LUPUS_API AdaptiveSearch : public ITextSearchStrategy
+		{
+		public:
+			using ITextSearchStrategy::Search;
+			//! \sa ICopyable::Copy
+			virtual Pointer<ITextSearchStrategy> Copy() const override;
+			//! \sa TextSearchStrategy::Search
+			virtual int Search(const char* text, int textLength, const char* search, int searchLength, CaseSensitivity sensitivity) const override;
+			//! \sa TextSearchStrategy::Compile
+			virtual Pointer<CompiledPattern> Compile(const String& pattern, CaseSensitivity sensitivity) const override;
+		};
+	}
+}
+
+#endif
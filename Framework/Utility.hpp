@@ -19,6 +19,8 @@
 #ifndef LUPUS_UTILITY_HPP
 #define LUPUS_UTITLIY_HPP
 
+#include <utility>
+
 /**
  * Iterate through whole container
  * @param item iteration variable as iterator type
@@ -32,7 +34,7 @@
 
 namespace Lupus {
 	/**
-	 * Swaps two values
+	 * Swaps two values by moving them
 	 *
 	 * @param lhs left hand value
 	 * @param rhs right hand value
@@ -20,8 +20,8 @@ namespace Lupus {
 	template <typename T>
 	void Swap(T& lhs, T& rhs)
 	{
-		T swp = lhs;
-		lhs = rhs;
-		rhs = swp;
+		T swp = std::move(lhs);
+		lhs = std::move(rhs);
+		rhs = std::move(swp);
 	}
 }
@@ -23,6 +23,11 @@
 #include "ISequence.hpp"
 #include "Iterator.hpp"
 #include "ISortStrategy.hpp"
+#include <cfloat>
+#include <climits>
+#include <cstddef>
+#include <new>
+#include <utility>
 
 namespace Lupus {
 	namespace System {
@@ -36,6 +41,10 @@ namespace Lupus {
 			int _length;
 			//! array capacity
 			int _capacity;
+			//! default growth factor
+			static float _defaultGrowthFactor;
+			//! factor the capacity grows by when exhausted
+			float _growthFactor = _defaultGrowthFactor;
 		public:
 			//! Return vector length
 			PropertyReader<int> Length = PropertyReader<int>(_length);
@@ -43,6 +52,10 @@ namespace Lupus {
 			PropertyReader<int> Capacity = PropertyReader<int>(_capacity);
 			//! Return vector array
 			PropertyReader<T*> Data = PropertyReader<T*>(_data);
+			//! Return factor the capacity grows by when full
+			PropertyReader<float> GrowthFactor = PropertyReader<float>(_growthFactor);
+			//! Return growth factor for new vectors
+			static PropertyReader<float> DefaultGrowthFactor;
 			//! create default instance
 			Vector();
 			//! copy from given instance
@@ -61,6 +74,11 @@ namespace Lupus {
 			virtual void Swap(Pointer<Iterator<T>>& lhs, Pointer<Iterator<T>>& rhs) override;
 			//! \sa ISequence::Add
 			virtual void Add(const T&) override;
+			//! move given item to the end
+			void Add(T&&);
+			//! construct an item at the end from given arguments
+			template <typename... Args>
+			void EmplaceBack(Args&&... args);
 			//! \sa ISequence::Back
 			virtual T& Back() override;
 			//! \sa ISequence::Back
@@ -89,6 +107,12 @@ namespace Lupus {
 			virtual void RemoveAt(int) override;
 			//! \sa ISequence::Resize
 			virtual void Resize(int) override;
+			//! allocate storage for at least count items, length stays unchanged
+			virtual void Reserve(int count) final;
+			//! set factor the capacity grows by when full, throws ArgumentOutOfRangeException unless finite and greater than one
+			void SetGrowthFactor(float factor);
+			//! set growth factor for new vectors, throws ArgumentOutOfRangeException unless finite and greater than one
+			static void SetDefaultGrowthFactor(float factor);
 			//! shrink capacity to fit length
 			virtual void ShrinkToFit() final;
 			//! get value at given index
@@ -102,6 +126,21 @@ namespace Lupus {
 			//! assign given collection
 			Vector<T>& operator=(const ICollection<T>&);
 		private:
+			//! allocate raw storage for capacity items
+			static T* Allocate(int capacity);
+			//! release raw storage
+			static void Deallocate(T* data);
+			//! throw ArgumentOutOfRangeException for growth factors that aren't finite or not greater than one
+			static void CheckGrowthFactor(float factor);
+			//! destroy items from startIndex up to endIndex
+			void Destroy(int startIndex, int endIndex);
+			//! capacity after growing by the growth factor, at least count and one more than now
+			int GrowCapacity(int count) const;
+			//! move items into new storage of given capacity
+			void Reallocate(int capacity);
+			//! move items into given storage, which replaces the current one
+			void Relocate(T* buffer, int capacity);
+
 			class VectorIterator : public Iterator<T>
 			{
 				friend class Vector<T>;
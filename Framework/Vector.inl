@@ -18,85 +18,88 @@
 
 namespace Lupus {
 	namespace System {
+		template <typename T>
+		float Vector<T>::_defaultGrowthFactor = 1.5f;
+		template <typename T>
+		PropertyReader<float> Vector<T>::DefaultGrowthFactor = PropertyReader<float>(Vector<T>::_defaultGrowthFactor);
+
 		template <typename T>
 		Vector<T>::Vector() :
-			_data(new T[DEFAULT_ARRAY_SIZE]),
+			_data(Allocate(DEFAULT_ARRAY_SIZE)),
 			_length(0),
 			_capacity(DEFAULT_ARRAY_SIZE)
 		{
 		}
 		
 		template <typename T>
-		Vector<T>::Vector(const Vector<T>& vector)
+		Vector<T>::Vector(const Vector<T>& vector) :
+			_data(Allocate((vector._length > 0) ? vector._length : DEFAULT_ARRAY_SIZE)),
+			_length(0),
+			_capacity((vector._length > 0) ? vector._length : DEFAULT_ARRAY_SIZE),
+			_growthFactor(vector._growthFactor)
 		{
-			if (vector._length == 0) {
-				Vector<T>::Vector();
-				return;
-			}
-
-			_data = new T[vector._length];
-			_length = _capacity = vector._length;
-
-			for (int i = _length - 1; i >= 0; i--) {
-				_data[i] = vector[i];
+			for (; _length < vector._length; _length++) {
+				new (_data + _length) T(vector._data[_length]);
 			}
 		}
 
 		template <typename T>
 		Vector<T>::Vector(Vector<T>&& vector) :
-			Vector()
+			_data(vector._data),
+			_length(vector._length),
+			_capacity(vector._capacity),
+			_growthFactor(vector._growthFactor)
 		{
-			Lupus::Swap(_data, vector._data);
-			Lupus::Swap(_length, vector._length);
-			Lupus::Swap(_capacity, vector._capacity);
+			// the moved vector is left without storage, it allocates again when needed
+			vector._data = nullptr;
+			vector._length = vector._capacity = 0;
 		}
 		
 		template <typename T>
-		Vector<T>::Vector(const ICollection<T>& collection)
+		Vector<T>::Vector(const ICollection<T>& collection) :
+			_data(Allocate((collection.Count() > 0) ? collection.Count() : DEFAULT_ARRAY_SIZE)),
+			_length(0),
+			_capacity((collection.Count() > 0) ? collection.Count() : DEFAULT_ARRAY_SIZE)
 		{
-			if (collection.Count() == 0) {
-				Vector<T>::Vector();
-				return;
-			}
-
-			int i = 0;
-			_data = new T[collection.Count()];
-			_capacity = _length = collection.Count();
-
 			foreach (item, collection) {
-				_data[i++] = item->CurrentItem();
+				new (_data + _length++) T(item->CurrentItem());
 			}
 		}
 
 		template <typename T>
 		Vector<T>::Vector(const std::initializer_list<T>& list) :
-			_data(new T[list.size()]),
-			_length((int)list.size()),
+			_data(Allocate((int)list.size())),
+			_length(0),
 			_capacity((int)list.size())
 		{
-			auto it = list.begin();
-			int i = 0;
-
 			for (const T& item : list) {
-				_data[i++] = item;
+				new (_data + _length++) T(item);
 			}
 		}
 
 		template <typename T>
-		Vector<T>::Vector(int count)
+		Vector<T>::Vector(int count) :
+			_data(nullptr),
+			_length(0),
+			_capacity(0)
 		{
 			if (count <= 0) {
 				throw ArgumentOutOfRangeException("count must be greater than zero");
 			}
 
-			_data = new T[count];
-			_length = _capacity = count;
+			_data = Allocate(count);
+			_capacity = count;
+
+			for (; _length < count; _length++) {
+				new (_data + _length) T();
+			}
 		}
 
 		template <typename T>
 		Vector<T>::~Vector()
 		{
-			delete[] _data;
+			Destroy(0, _length);
+			Deallocate(_data);
 		}
 
 		template <typename T>
@@ -121,18 +124,38 @@ namespace Lupus {
 
 		template <typename T>
 		void Vector<T>::Add(const T& item)
+		{
+			EmplaceBack(item);
+		}
+
+		template <typename T>
+		void Vector<T>::Add(T&& item)
+		{
+			EmplaceBack(std::move(item));
+		}
+
+		template <typename T>
+		template <typename... Args>
+		void Vector<T>::EmplaceBack(Args&&... args)
 		{
 			if (_length < _capacity) {
-				_data[_length++] = item;
+				new (_data + _length) T(std::forward<Args>(args)...);
 			} else {
-				T* buffer = new T[_capacity + 1];
-
-				for (int i = 0; i < _length; i++) {
-					buffer[i] = _data[i];
+				// construct before relocating, the arguments may refer to items of this vector
+				int capacity = GrowCapacity(_length + 1);
+				T* buffer = Allocate(capacity);
+
+				try {
+					new (buffer + _length) T(std::forward<Args>(args)...);
+				} catch (...) {
+					Deallocate(buffer);
+					throw;
 				}
 
-				buffer[_length++] = item;
+				Relocate(buffer, capacity);
 			}
+
+			_length++;
 		}
 
 		template <typename T>
@@ -166,6 +189,7 @@ namespace Lupus {
 		template <typename T>
 		void Vector<T>::Clear()
 		{
+			Destroy(0, _length);
 			_length = 0;
 		}
 
@@ -181,6 +205,10 @@ namespace Lupus {
 			return false;
 		}
 
+		//! vectorized search, defined next to FindChar in Simd.cpp
+		template <>
+		LUPUS_API bool Vector<char>::Contains(const char& item) const;
+
 		template <typename T>
 		void Vector<T>::CopyTo(Vector<T>& vector, int startIndex) const
 		{
@@ -250,14 +278,27 @@ namespace Lupus {
 				throw ArgumentOutOfRangeException("index must be greater than zero");
 			}
 
-			// variables
-			Vector<T> vector(_length + 1);
+			// item may be part of this vector
+			T copy(item);
+
+			if (_length == _capacity) {
+				Reallocate(GrowCapacity(_length + 1));
+			}
 
-			// set result
-			CopyTo(0, vector, 0, index);
-			vector[index] = item;
-			CopyTo(index, vector, index + 1, _length - index);
-			Lupus::Swap(vector, *this);
+			// move items behind index one position back, the last one into raw storage
+			if (index == _length) {
+				new (_data + _length) T(std::move(copy));
+			} else {
+				new (_data + _length) T(std::move(_data[_length - 1]));
+
+				for (int i = _length - 1; i > index; i--) {
+					_data[i] = std::move(_data[i - 1]);
+				}
+
+				_data[index] = std::move(copy);
+			}
+
+			_length += 1;
 		}
 
 		template <typename T>
@@ -276,11 +317,12 @@ namespace Lupus {
 				throw ArgumentOutOfRangeException("index must be greater than zero");
 			}
 
-			for (int i = index; i < _length; i++) {
-				_data[i] = _data[i + 1];
+			for (int i = index; i < _length - 1; i++) {
+				_data[i] = std::move(_data[i + 1]);
 			}
 
 			_length -= 1;
+			Destroy(_length, _length + 1);
 		}
 
 		template <typename T>
@@ -293,46 +335,57 @@ namespace Lupus {
 
 			// check if count is less than length
 			if (count <= _length) {
+				Destroy(count, _length);
 				_length = count;
 				return;
 			}
 
-			// variables
-			T* swap = new T[count];
-
-			for (int i = 0; i < count; i++) {
-				if (i < _length) {
-					swap[i] = _data[i];
-				} else {
-					swap[i] = T();
-				}
+			// grow storage if needed, new items are default values
+			if (count > _capacity) {
+				Reallocate(GrowCapacity(count));
 			}
 
-			// set new length
-			_length = _capacity = count;
+			for (; _length < count; _length++) {
+				new (_data + _length) T();
+			}
 		}
 
 		template <typename T>
-		void Vector<T>::ShrinkToFit()
+		void Vector<T>::Reserve(int count)
 		{
-			// check length
-			if (_length <= 0) {
-				delete _data;
-				_data = new T[1];
-				_length = 0;
-				_capacity = 1;
-				return;
+			// check argument
+			if (count < 0) {
+				throw ArgumentOutOfRangeException("count must be greater than zero");
 			}
 
-			T* swap = new T[_length];
-
-			for (int i = 0; i < _length; i++) {
-				swap[i] = _data[i];
+			if (count > _capacity) {
+				Reallocate(count);
 			}
+		}
+
+		template <typename T>
+		void Vector<T>::SetGrowthFactor(float factor)
+		{
+			CheckGrowthFactor(factor);
+			_growthFactor = factor;
+		}
 
-			_capacity = _length;
-			Lupus::Swap(swap, _data);
-			delete swap;
+		template <typename T>
+		void Vector<T>::SetDefaultGrowthFactor(float factor)
+		{
+			CheckGrowthFactor(factor);
+			_defaultGrowthFactor = factor;
+		}
+
+		template <typename T>
+		void Vector<T>::ShrinkToFit()
+		{
+			// keep storage for one item
+			int capacity = (_length > 0) ? _length : 1;
+
+			if (capacity != _capacity) {
+				Reallocate(capacity);
+			}
 		}
 
 		template <typename T>
@@ -362,17 +415,27 @@ namespace Lupus {
 		template <typename T>
 		Vector<T>& Vector<T>::operator=(const Vector<T>& vector)
 		{
+			if (this == &vector) {
+				return (*this);
+			}
+
+			// reuse storage if large enough
+			Clear();
+
 			if (vector._length > _capacity) {
-				delete[] _data;
-				_data = new T[vector._length];
+				// release first, so a failed allocation leaves an empty vector
+				Deallocate(_data);
+				_data = nullptr;
+				_capacity = 0;
+				_data = Allocate(vector._length);
 				_capacity = vector._length;
 			}
 
-			for (int i = vector._length - 1; i >= 0; i--) {
-				_data[i] = vector._data[i];
+			for (; _length < vector._length; _length++) {
+				new (_data + _length) T(vector._data[_length]);
 			}
 
-			_length = vector._length;
+			_growthFactor = vector._growthFactor;
 
 			return (*this);
 		}
@@ -383,38 +446,105 @@ namespace Lupus {
 			Lupus::Swap(_data, vector._data);
 			Lupus::Swap(_length, vector._length);
 			Lupus::Swap(_capacity, vector._capacity);
+			Lupus::Swap(_growthFactor, vector._growthFactor);
 			return (*this);
 		}
 
 		template <typename T>
 		Vector<T>& Vector<T>::operator=(const ICollection<T>& collection)
 		{
-			// copy content
-			if (_capacity < collection.Count()) {
-				int i = 0;
-				T* buffer = new T[collection.Count()];
-				_capacity = _length = collection.Count();
+			if (static_cast<const ICollection<T>*>(this) == &collection) {
+				return (*this);
+			}
 
-				foreach (item, collection) {
-					buffer[i++] = item->CurrentItem();
-				}
+			// reuse storage if large enough
+			Clear();
 
-				// swap content
-				delete[] _data;
-				_data = buffer;
-			} else {
-				int i = 0;
-
-				foreach (item, collection) {
-					_data[i++] = item->CurrentItem();
-				}
+			if (collection.Count() > _capacity) {
+				// release first, so a failed allocation leaves an empty vector
+				Deallocate(_data);
+				_data = nullptr;
+				_capacity = 0;
+				_data = Allocate(collection.Count());
+				_capacity = collection.Count();
+			}
 
-				_length = collection.Count();
+			foreach (item, collection) {
+				new (_data + _length++) T(item->CurrentItem());
 			}
 
 			return (*this);
 		}
 
+		template <typename T>
+		T* Vector<T>::Allocate(int capacity)
+		{
+			// size in bytes must not overflow
+			if (static_cast<std::size_t>(capacity) > static_cast<std::size_t>(-1) / sizeof(T)) {
+				throw OutOfMemoryException("vector capacity exceeds addressable memory");
+			}
+
+			// raw storage, items are constructed in place
+			return static_cast<T*>(::operator new(capacity * sizeof(T)));
+		}
+
+		template <typename T>
+		void Vector<T>::Deallocate(T* data)
+		{
+			::operator delete(data);
+		}
+
+		template <typename T>
+		void Vector<T>::Destroy(int startIndex, int endIndex)
+		{
+			for (int i = startIndex; i < endIndex; i++) {
+				_data[i].~T();
+			}
+		}
+
+		template <typename T>
+		int Vector<T>::GrowCapacity(int count) const
+		{
+			// variables
+			double grown = _capacity * static_cast<double>(_growthFactor);
+			int result = (grown < INT_MAX) ? static_cast<int>(grown) : INT_MAX;
+
+			// small capacities may round down to no growth at all
+			if (result <= _capacity && _capacity < INT_MAX) {
+				result = _capacity + 1;
+			}
+
+			return (result < count) ? count : result;
+		}
+
+		template <typename T>
+		void Vector<T>::CheckGrowthFactor(float factor)
+		{
+			if (!(factor > 1.0f) || factor > FLT_MAX) {
+				throw ArgumentOutOfRangeException("growth factor must be finite and greater than one");
+			}
+		}
+
+		template <typename T>
+		void Vector<T>::Reallocate(int capacity)
+		{
+			Relocate(Allocate(capacity), capacity);
+		}
+
+		template <typename T>
+		void Vector<T>::Relocate(T* buffer, int capacity)
+		{
+			// move items into the new storage and release the old one
+			for (int i = 0; i < _length; i++) {
+				new (buffer + i) T(std::move(_data[i]));
+				_data[i].~T();
+			}
+
+			Deallocate(_data);
+			_data = buffer;
+			_capacity = capacity;
+		}
+
 		template <typename T>
 		Vector<T>::VectorIterator::VectorIterator(const Vector<T>* vector) :
 			_vector(vector)
@@ -0,0 +1,137 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "..\Framework\String.hpp"
+#include "..\Framework\Vector.hpp"
+#include "..\Framework\AhoCorasick.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	TEST_CLASS(AhoCorasickTest)
+	{
+		TEST_METHOD(AhoCorasickFindAllTest)
+		{
+			// variables
+			Vector<String> patterns = { "he", "she", "his", "hers" };
+			AhoCorasick automaton(patterns);
+			Vector<PatternMatch> result = automaton.FindAll("ushers", 6);
+
+			// overlapping matches ordered by their end
+			Assert::AreEqual(4, (int)automaton.Count, L"Count", LINE_INFO());
+			Assert::AreEqual(3, (int)result.Length, L"FindAll", LINE_INFO());
+			Assert::AreEqual(1, result[0].Index, L"FindAll", LINE_INFO());
+			Assert::AreEqual(1, result[0].Pattern, L"FindAll", LINE_INFO());
+			Assert::AreEqual(2, result[1].Index, L"FindAll", LINE_INFO());
+			Assert::AreEqual(0, result[1].Pattern, L"FindAll", LINE_INFO());
+			Assert::AreEqual(2, result[2].Index, L"FindAll", LINE_INFO());
+			Assert::AreEqual(3, result[2].Pattern, L"FindAll", LINE_INFO());
+			Assert::AreEqual(4, result[2].Length, L"FindAll", LINE_INFO());
+
+			// no match
+			Assert::AreEqual(0, (int)automaton.FindAll("abc", 3).Length, L"FindAll", LINE_INFO());
+
+			// more matches than the default vector capacity
+			String many;
+
+			for (int i = 0; i < 100; i++) {
+				many += "he";
+			}
+
+			result = automaton.FindAll(many.Data, many.Length);
+			Assert::AreEqual(100, (int)result.Length, L"FindAll", LINE_INFO());
+			Assert::AreEqual(198, result[99].Index, L"FindAll", LINE_INFO());
+		}
+
+		TEST_METHOD(AhoCorasickFindTest)
+		{
+			// variables
+			Vector<String> patterns = { "bcd", "abcdef", "", "abc", "cd" };
+			AhoCorasick automaton(patterns);
+			AhoCorasick insensitive(patterns, CaseSensitivity::CaseInsensitive);
+			PatternMatch match;
+
+			// leftmost match, earlier pattern on equal positions
+			match = automaton.Find("xxabcdefg", 9);
+			Assert::AreEqual(2, match.Index, L"Find", LINE_INFO());
+			Assert::AreEqual(1, match.Pattern, L"Find", LINE_INFO());
+			Assert::AreEqual(6, match.Length, L"Find", LINE_INFO());
+
+			match = automaton.Find("xxabcdxx", 8);
+			Assert::AreEqual(2, match.Index, L"Find", LINE_INFO());
+			Assert::AreEqual(3, match.Pattern, L"Find", LINE_INFO());
+
+			// leftmost longest match
+			match = automaton.FindLongest("xxabcdxx", 8);
+			Assert::AreEqual(2, match.Index, L"FindLongest", LINE_INFO());
+			Assert::AreEqual(3, match.Pattern, L"FindLongest", LINE_INFO());
+			match = automaton.FindLongest("xbcdabcdefg", 11);
+			Assert::AreEqual(1, match.Index, L"FindLongest", LINE_INFO());
+			Assert::AreEqual(0, match.Pattern, L"FindLongest", LINE_INFO());
+			match = automaton.FindLongest("xxabcdefg", 9);
+			Assert::AreEqual(1, match.Pattern, L"FindLongest", LINE_INFO());
+			Assert::AreEqual(-1, automaton.FindLongest("xyz", 3).Index, L"FindLongest", LINE_INFO());
+
+			// case sensitivity
+			Assert::AreEqual(-1, automaton.Find("XXABCD", 6).Index, L"Find", LINE_INFO());
+			Assert::AreEqual(2, insensitive.Find("XXABCD", 6).Index, L"Find", LINE_INFO());
+			Assert::AreEqual(-1, automaton.Find("", 0).Index, L"Find", LINE_INFO());
+		}
+
+		TEST_METHOD(AhoCorasickLargeAlphabetTest)
+		{
+			// variables
+			Vector<String> patterns = {
+				"ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+				"abcdefghijklmnopqrstuvwxyz",
+				"0123456789",
+				"!\"#$%&'()*+,-./:;<=>?@[]^_`{|}~"
+			};
+			AhoCorasick automaton(patterns);
+			Vector<PatternMatch> result = automaton.FindAll("..0123456789..xyz{|}~..abcdefghijklmnopqrstuvwxyz", 49);
+
+			// compressed transitions
+			Assert::AreEqual(2, (int)result.Length, L"FindAll", LINE_INFO());
+			Assert::AreEqual(2, result[0].Index, L"FindAll", LINE_INFO());
+			Assert::AreEqual(2, result[0].Pattern, L"FindAll", LINE_INFO());
+			Assert::AreEqual(23, result[1].Index, L"FindAll", LINE_INFO());
+			Assert::AreEqual(1, result[1].Pattern, L"FindAll", LINE_INFO());
+		}
+
+		TEST_METHOD(AhoCorasickStringTest)
+		{
+			// variables
+			String string("error: disk full, warning: retry");
+			Vector<String> patterns = { "warning", "error", "fatal" };
+			AhoCorasick automaton(patterns);
+
+			// string interface
+			Assert::AreEqual(0, string.IndexOfAny(patterns), L"IndexOfAny", LINE_INFO());
+			Assert::AreEqual(18, string.IndexOfAny(patterns, 1), L"IndexOfAny", LINE_INFO());
+			Assert::AreEqual(18, string.IndexOfAny(automaton, 1), L"IndexOfAny", LINE_INFO());
+			Assert::AreEqual(0, string.IndexOfAny(Vector<String>({ "DISK", "ERROR" }), 0, CaseSensitivity::CaseInsensitive), L"IndexOfAny", LINE_INFO());
+			Assert::AreEqual(-1, string.IndexOfAny(Vector<String>({ "fatal" })), L"IndexOfAny", LINE_INFO());
+			Assert::AreEqual(2, (int)string.FindAll(automaton).Length, L"FindAll", LINE_INFO());
+			Assert::AreEqual(1, (int)string.FindAll(Vector<String>({ "DISK" }), CaseSensitivity::CaseInsensitive).Length, L"FindAll", LINE_INFO());
+		}
+	};
+}
@@ -0,0 +1,95 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include <cstring>
+#include "..\Framework\CharSet.hpp"
+#include "..\Framework\String.hpp"
+#include "..\Framework\Exception.hpp"
+#include "..\Framework\Vector.hpp"
+#include "..\Framework\Simd.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	TEST_CLASS(CharSetTest)
+	{
+		TEST_METHOD(CharSetConstructorTest)
+		{
+			// variables
+			CharSet empty;
+			CharSet set(" \t,;");
+			Vector<char> vector = { ',', ';', '\t', ' ' };
+
+			// empty set
+			Assert::IsTrue(empty.IsEmpty(), L"CharSet()", LINE_INFO());
+			Assert::AreEqual(0, empty.Count(), L"CharSet()", LINE_INFO());
+			Assert::IsTrue(CharSet(nullptr).IsEmpty(), L"CharSet(nullptr)", LINE_INFO());
+
+			// native string
+			Assert::AreEqual(4, set.Count(), L"CharSet(const char*)", LINE_INFO());
+			Assert::IsTrue(set.Contains(',') && set.Contains('\t') && !set.Contains('a') && !set.Contains('\0'), L"Contains", LINE_INFO());
+			Assert::IsTrue(set.IsAscii(), L"IsAscii", LINE_INFO());
+
+			// sequence
+			Assert::IsTrue(CharSet(vector) == set, L"CharSet(const ISequence<char>&)", LINE_INFO());
+		}
+
+		TEST_METHOD(CharSetModifyTest)
+		{
+			// variables
+			CharSet set("ab");
+
+			// add and remove
+			set.Add('\xff').Add('c').Remove('a');
+			Assert::AreEqual(3, set.Count(), L"Add", LINE_INFO());
+			Assert::IsTrue(set.Contains('\xff') && !set.Contains('a'), L"Remove", LINE_INFO());
+			Assert::IsFalse(set.IsAscii(), L"IsAscii", LINE_INFO());
+
+			// fold case
+			Assert::IsTrue(CharSet("aB1").FoldCase() == CharSet("AaBb1"), L"FoldCase", LINE_INFO());
+			Assert::IsTrue(CharSet("a") != CharSet("A"), L"operator!=", LINE_INFO());
+		}
+
+		TEST_METHOD(CharSetFindTest)
+		{
+			// variables
+			char text[301];
+			CharSet ascii(",;");
+			CharSet extended(",\x80");
+
+			// match at every offset of a block
+			memset(text, 'x', 300);
+			text[300] = 0;
+
+			for (int i = 0; i < 300; i++) {
+				text[i] = ';';
+				Assert::AreEqual(i, FindAnyChar(text, 300, ascii), L"FindAnyChar", LINE_INFO());
+				Assert::AreEqual(i, FindLastAnyChar(text, 300, ascii), L"FindLastAnyChar", LINE_INFO());
+				Assert::AreEqual(-1, FindAnyChar(text, 300, extended), L"FindAnyChar", LINE_INFO());
+				text[i] = '\x80';
+				Assert::AreEqual(-1, FindAnyChar(text, 300, ascii), L"FindAnyChar", LINE_INFO());
+				Assert::AreEqual(i, FindAnyChar(text, 300, extended), L"FindAnyChar", LINE_INFO());
+				text[i] = 'x';
+			}
+		}
+	};
+}
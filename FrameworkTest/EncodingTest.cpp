@@ -0,0 +1,133 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "..\Framework\Encoding.hpp"
+#include "..\Framework\Simd.hpp"
+#include "..\Framework\String.hpp"
+#include "..\Framework\Exception.hpp"
+#include <cstring>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	TEST_CLASS(EncodingTest)
+	{
+		int FindInvalid(const char* text)
+		{
+			return FindInvalidUtf8(text, static_cast<int>(strlen(text)));
+		}
+
+		TEST_METHOD(EncodingFindInvalidUtf8Test)
+		{
+			// valid
+			Assert::AreEqual(-1, FindInvalidUtf8("", 0), L"empty", LINE_INFO());
+			Assert::AreEqual(-1, FindInvalid("ascii only"), L"ascii", LINE_INFO());
+			Assert::AreEqual(-1, FindInvalid("\xc2\x80\xdf\xbf"), L"2 bytes", LINE_INFO());
+			Assert::AreEqual(-1, FindInvalid("\xe0\xa0\x80\xed\x9f\xbf\xee\x80\x80\xef\xbf\xbf"), L"3 bytes", LINE_INFO());
+			Assert::AreEqual(-1, FindInvalid("\xf0\x90\x80\x80\xf4\x8f\xbf\xbf"), L"4 bytes", LINE_INFO());
+
+			// invalid
+			Assert::AreEqual(1, FindInvalid("a\x80"), L"continuation", LINE_INFO());
+			Assert::AreEqual(0, FindInvalid("\xc0\xaf"), L"overlong 2 bytes", LINE_INFO());
+			Assert::AreEqual(0, FindInvalid("\xe0\x9f\xbf"), L"overlong 3 bytes", LINE_INFO());
+			Assert::AreEqual(0, FindInvalid("\xf0\x8f\xbf\xbf"), L"overlong 4 bytes", LINE_INFO());
+			Assert::AreEqual(0, FindInvalid("\xed\xa0\x80"), L"surrogate", LINE_INFO());
+			Assert::AreEqual(0, FindInvalid("\xf4\x90\x80\x80"), L"above 0x10ffff", LINE_INFO());
+			Assert::AreEqual(0, FindInvalid("\xf5\x80\x80\x80"), L"lead byte", LINE_INFO());
+			Assert::AreEqual(2, FindInvalid("ab\xe2\x82"), L"truncated", LINE_INFO());
+			Assert::AreEqual(0, FindInvalid("\xe2\x82" "a"), L"too short", LINE_INFO());
+		}
+
+		TEST_METHOD(EncodingFindInvalidUtf8BlockTest)
+		{
+			// variables
+			char text[200];
+
+			// errors at every position of long text, crossing block boundaries
+			for (int i = 0; i < 197; i++) {
+				memset(text, 'a', sizeof(text));
+				memcpy(text + i, "\xe2\x82\xac", 3);
+				Assert::AreEqual(-1, FindInvalidUtf8(text, sizeof(text)), L"valid", LINE_INFO());
+				Assert::AreEqual(i, FindInvalidUtf8(text, i + 2), L"truncated", LINE_INFO());
+				text[i + 1] = 'a';
+				Assert::AreEqual(i, FindInvalidUtf8(text, sizeof(text)), L"too short", LINE_INFO());
+				text[i] = '\xbf';
+				Assert::AreEqual(i, FindInvalidUtf8(text, sizeof(text)), L"continuation", LINE_INFO());
+			}
+		}
+
+		TEST_METHOD(EncodingUtf16Test)
+		{
+			// variables
+			const char* text = "a\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80 ascii run";
+			ushort expected[] = { 'a', 0xe4, 0x20ac, 0xd83d, 0xde00, ' ', 'a', 's', 'c', 'i', 'i', ' ', 'r', 'u', 'n' };
+			ushort units[32];
+			char chars[64];
+			int length = static_cast<int>(strlen(text));
+
+			// utf-8 to utf-16
+			Assert::AreEqual(15, Utf8ToUtf16(text, length, nullptr), L"Utf8ToUtf16", LINE_INFO());
+			Assert::AreEqual(15, Utf8ToUtf16(text, length, units), L"Utf8ToUtf16", LINE_INFO());
+			Assert::IsTrue(memcmp(units, expected, sizeof(expected)) == 0, L"Utf8ToUtf16", LINE_INFO());
+
+			// utf-16 to utf-8
+			Assert::AreEqual(length, Utf16ToUtf8(expected, 15, nullptr), L"Utf16ToUtf8", LINE_INFO());
+			Assert::AreEqual(length, Utf16ToUtf8(expected, 15, chars), L"Utf16ToUtf8", LINE_INFO());
+			Assert::IsTrue(memcmp(chars, text, length) == 0, L"Utf16ToUtf8", LINE_INFO());
+
+			// errors
+			ushort lone[] = { 'a', 'b', 0xdc00, 'c', 0xd800 };
+			Assert::ExpectException<EncodingException>([&]() { Utf8ToUtf16("ab\xff", 3, units); }, L"Utf8ToUtf16", LINE_INFO());
+			Assert::ExpectException<EncodingException>([&]() { Utf16ToUtf8(lone, 3, chars); }, L"Utf16ToUtf8", LINE_INFO());
+			Assert::ExpectException<EncodingException>([&]() { Utf16ToUtf8(lone + 3, 2, chars); }, L"Utf16ToUtf8", LINE_INFO());
+			Assert::ExpectException<ArgumentNullException>([&]() { Utf8ToUtf16(nullptr, 1, units); }, L"Utf8ToUtf16", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { Utf16ToUtf8(lone, -1, chars); }, L"Utf16ToUtf8", LINE_INFO());
+			Assert::AreEqual(0, Utf8ToUtf16(nullptr, 0, nullptr), L"Utf8ToUtf16", LINE_INFO());
+		}
+
+		TEST_METHOD(EncodingUtf32Test)
+		{
+			// variables
+			const char* text = "a\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80 ascii run";
+			uint expected[] = { 'a', 0xe4, 0x20ac, 0x1f600, ' ', 'a', 's', 'c', 'i', 'i', ' ', 'r', 'u', 'n' };
+			uint points[32];
+			char chars[64];
+			int length = static_cast<int>(strlen(text));
+
+			// utf-8 to utf-32
+			Assert::AreEqual(14, Utf8ToUtf32(text, length, nullptr), L"Utf8ToUtf32", LINE_INFO());
+			Assert::AreEqual(14, Utf8ToUtf32(text, length, points), L"Utf8ToUtf32", LINE_INFO());
+			Assert::IsTrue(memcmp(points, expected, sizeof(expected)) == 0, L"Utf8ToUtf32", LINE_INFO());
+
+			// utf-32 to utf-8
+			Assert::AreEqual(length, Utf32ToUtf8(expected, 14, nullptr), L"Utf32ToUtf8", LINE_INFO());
+			Assert::AreEqual(length, Utf32ToUtf8(expected, 14, chars), L"Utf32ToUtf8", LINE_INFO());
+			Assert::IsTrue(memcmp(chars, text, length) == 0, L"Utf32ToUtf8", LINE_INFO());
+
+			// errors
+			uint invalid[] = { 0xd800, 0x110000 };
+			Assert::ExpectException<EncodingException>([&]() { Utf8ToUtf32("\xed\xa0\x80", 3, points); }, L"Utf8ToUtf32", LINE_INFO());
+			Assert::ExpectException<EncodingException>([&]() { Utf32ToUtf8(invalid, 1, chars); }, L"Utf32ToUtf8", LINE_INFO());
+			Assert::ExpectException<EncodingException>([&]() { Utf32ToUtf8(invalid + 1, 1, chars); }, L"Utf32ToUtf8", LINE_INFO());
+		}
+	};
+}
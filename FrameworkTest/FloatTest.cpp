@@ -19,13 +19,16 @@
 #include "CppUnitTest.h"
 #include "..\Framework\String.hpp"
 #include "..\Framework\Float.hpp"
+#include "..\Framework\Exception.hpp"
+#include "..\Framework\Vector.hpp"
+#include <limits>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Lupus;
 using namespace Lupus::System;
 
 namespace FrameworkTest {
-	TEST_CLASS(IntegerTest)
+	TEST_CLASS(FloatTest)
 	{
 		TEST_METHOD(FloatToStringTest)
 		{
@@ -34,10 +37,87 @@ namespace FrameworkTest {
 			double d = 1.23456789;
 			real r = 1.23456789101112;
 
+			real p;
+
 			// to string
-			Assert::IsTrue(String("1.234000").Compare(Float::ToString(f)) == 0, L"ToString", LINE_INFO());
-			Assert::IsTrue(String("1.234568").Compare(Float::ToString(d)) == 0, L"ToString", LINE_INFO());
-			Assert::IsTrue(String("1.234568").Compare(Float::ToString(r)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("1.234").Compare(Float::ToString(f)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("1.23456789").Compare(Float::ToString(d)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(Float::TryParse(Float::ToString(r), p), L"ToString", LINE_INFO());
+			Assert::IsTrue(p == r, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("0.1").Compare(Float::ToString(0.1)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("0.3").Compare(Float::ToString(0.3f)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("0.30000000000000004").Compare(Float::ToString(0.1 + 0.2)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("100").Compare(Float::ToString(100.0)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("1e+100").Compare(Float::ToString(1e100)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("1.7976931348623157e+308").Compare(Float::ToString(1.7976931348623157e308)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("5e-324").Compare(Float::ToString(4.9406564584124654e-324)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("0.0001").Compare(Float::ToString(0.0001)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("1e-05").Compare(Float::ToString(0.00001)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("0").Compare(Float::ToString(0.0)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("-0").Compare(Float::ToString(-0.0)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(String("-2.5").Compare(Float::ToString(-2.5)) == 0, L"ToString", LINE_INFO());
+
+			// not the shortest digits, 20.3592132505176 parses back to the same value
+			Assert::IsTrue(String("20.359213250517598").Compare(Float::ToString(20.3592132505176)) == 0, L"ToString", LINE_INFO());
+			Assert::IsTrue(Float::TryParse(Float::ToString(20.3592132505176), d), L"ToString", LINE_INFO());
+			Assert::IsTrue(d == 20.3592132505176, L"ToString", LINE_INFO());
+		}
+
+		TEST_METHOD(FloatToStringFormatTest)
+		{
+			// fixed
+			Assert::IsTrue(String("3.14").Compare(Float::ToString(3.14159, FloatFormat::Fixed, 2)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("2.500").Compare(Float::ToString(2.5, FloatFormat::Fixed, 3)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("2").Compare(Float::ToString(2.5, FloatFormat::Fixed, 0)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("10").Compare(Float::ToString(9.99, FloatFormat::Fixed, 0)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("0.00").Compare(Float::ToString(0.001, FloatFormat::Fixed, 2)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("0.000012").Compare(Float::ToString(1.2e-5, FloatFormat::Fixed)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("1200000").Compare(Float::ToString(1.2e6, FloatFormat::Fixed)) == 0, L"Fixed", LINE_INFO());
+
+			// precision rounds the exact binary value, not the shortest digits
+			Assert::IsTrue(String("2.67").Compare(Float::ToString(2.675, FloatFormat::Fixed, 2)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("1.01").Compare(Float::ToString(1.015, FloatFormat::Fixed, 2)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("0.1").Compare(Float::ToString(0.15, FloatFormat::Fixed, 1)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("0.1000000000000000055511").Compare(Float::ToString(0.1, FloatFormat::Fixed, 22)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("0.000000000000000000010000").Compare(Float::ToString(1e-20, FloatFormat::Fixed, 24)) == 0, L"Fixed", LINE_INFO());
+			Assert::IsTrue(String("0.01").Compare(Float::ToString(0.006, FloatFormat::Fixed, 2)) == 0, L"Fixed", LINE_INFO());
+
+			// scientific
+			Assert::IsTrue(String("1.2e+06").Compare(Float::ToString(1.2e6, FloatFormat::Scientific)) == 0, L"Scientific", LINE_INFO());
+			Assert::IsTrue(String("1.23e-05").Compare(Float::ToString(1.2345e-5, FloatFormat::Scientific, 2)) == 0, L"Scientific", LINE_INFO());
+			Assert::IsTrue(String("1.000e+01").Compare(Float::ToString(9.9999, FloatFormat::Scientific, 3)) == 0, L"Scientific", LINE_INFO());
+			Assert::IsTrue(String("1e+300").Compare(Float::ToString(1e300, FloatFormat::Scientific)) == 0, L"Scientific", LINE_INFO());
+			Assert::IsTrue(String("2.67e+00").Compare(Float::ToString(2.675, FloatFormat::Scientific, 2)) == 0, L"Scientific", LINE_INFO());
+			Assert::IsTrue(String("4.9406564584124654e-324").Compare(Float::ToString(4.9406564584124654e-324, FloatFormat::Scientific, 16)) == 0, L"Scientific", LINE_INFO());
+
+			// general
+			Assert::IsTrue(String("1.2e+02").Compare(Float::ToString(123.0, FloatFormat::General, 2)) == 0, L"General", LINE_INFO());
+			Assert::IsTrue(String("123").Compare(Float::ToString(123.0, FloatFormat::General, 3)) == 0, L"General", LINE_INFO());
+			Assert::IsTrue(String("0.33").Compare(Float::ToString(1.0 / 3, FloatFormat::General, 2)) == 0, L"General", LINE_INFO());
+			Assert::IsTrue(String("1").Compare(Float::ToString(1.015, FloatFormat::General, 2)) == 0, L"General", LINE_INFO());
+			Assert::IsTrue(String("0.15").Compare(Float::ToString(0.15f, FloatFormat::General, 2)) == 0, L"General", LINE_INFO());
+
+			// special values
+			Assert::IsTrue(String("inf").Compare(Float::ToString(std::numeric_limits<double>::infinity())) == 0, L"Special", LINE_INFO());
+			Assert::IsTrue(String("-inf").Compare(Float::ToString(-std::numeric_limits<float>::infinity())) == 0, L"Special", LINE_INFO());
+			Assert::IsTrue(String("nan").Compare(Float::ToString(std::numeric_limits<double>::quiet_NaN())) == 0, L"Special", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([]() { Float::ToString(1.0, FloatFormat::Fixed, 100); }, L"Precision", LINE_INFO());
+		}
+
+		TEST_METHOD(FloatFormatToTest)
+		{
+			// variables
+			char buffer[Float::MaxFormatLength];
+			String string("x = ");
+
+			// format
+			Assert::AreEqual(6, Float::FormatTo(buffer, 0.0625), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String("0.0625").Compare(buffer) == 0, L"FormatTo", LINE_INFO());
+			Assert::AreEqual(309, Float::FormatTo(buffer, 1e308, FloatFormat::Fixed), L"FormatTo", LINE_INFO());
+			Assert::AreEqual(Float::MaxFormatLength - 1, Float::FormatTo(buffer, -1.7976931348623157e308, FloatFormat::Fixed, 99), L"FormatTo", LINE_INFO());
+
+			// append
+			Assert::IsTrue(String("x = 0.5").Compare(Float::AppendTo(string, 0.5f)) == 0, L"AppendTo", LINE_INFO());
 		}
 
 		TEST_METHOD(FloatTryParseTest)
@@ -53,5 +133,109 @@ namespace FrameworkTest {
 			Assert::IsTrue(Float::TryParse(string, d), L"TryParse", LINE_INFO());
 			Assert::IsTrue(Float::TryParse(string, r), L"TryParse", LINE_INFO());
 		}
+
+		TEST_METHOD(FloatTryParseStrictTest)
+		{
+			// variables
+			double d = 0;
+			float f = 0;
+
+			// exact results
+			Assert::IsTrue(Float::TryParse("0.1", d) && d == 0.1, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("-1.5e3", d) && d == -1500.0, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse(".5", d) && d == 0.5, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("5.", d) && d == 5.0, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("1.7976931348623157e308", d) && d == 1.7976931348623157e308, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("4.9406564584124654e-324", d) && d == 4.9406564584124654e-324, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("1e400", d) && d == std::numeric_limits<double>::infinity(), L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("1e-400", d) && d == 0.0, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("-inf", d) && d == -std::numeric_limits<double>::infinity(), L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("NaN", d) && d != d, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("3.4028234663852886e38", f) && f == (std::numeric_limits<float>::max)(), L"TryParse", LINE_INFO());
+
+			// halfway cases round to even, the digits after the 19th decide the rest
+			Assert::IsTrue(Float::TryParse("9007199254740993", d) && d == 9007199254740992.0, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("9007199254740993.00000000000000000001", d) && d == 9007199254740994.0, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("1.000000059604644775390625", f) && f == 1.0f, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse("1.000000059604644775390626", f) && f == 1.00000012f, L"TryParse", LINE_INFO());
+
+			// invalid strings leave the result untouched
+			d = 2.0;
+			Assert::IsFalse(Float::TryParse("", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Float::TryParse(" 1", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Float::TryParse("1.5x", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Float::TryParse("1e", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Float::TryParse(".", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Float::TryParse("1,5", d), L"TryParse", LINE_INFO());
+			Assert::IsTrue(d == 2.0, L"TryParse", LINE_INFO());
+		}
+
+		TEST_METHOD(FloatTryParseConsumedTest)
+		{
+			// variables
+			const char* line = "2.5e3;-0.125,7e+x";
+			double d = 0;
+			int consumed = 0;
+
+			// numbers within a larger buffer
+			Assert::IsTrue(Float::TryParse(StringView(line, 17), d, consumed), L"TryParse", LINE_INFO());
+			Assert::AreEqual(5, consumed, L"TryParse", LINE_INFO());
+			Assert::IsTrue(d == 2500.0, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse(StringView(line + 6, 11), d, consumed), L"TryParse", LINE_INFO());
+			Assert::AreEqual(6, consumed, L"TryParse", LINE_INFO());
+			Assert::IsTrue(d == -0.125, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Float::TryParse(StringView(line + 13, 4), d, consumed), L"TryParse", LINE_INFO());
+			Assert::AreEqual(1, consumed, L"TryParse", LINE_INFO());
+			Assert::IsTrue(d == 7.0, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Float::TryParse(StringView(line + 5, 12), d, consumed), L"TryParse", LINE_INFO());
+			Assert::AreEqual(0, consumed, L"TryParse", LINE_INFO());
+
+			// round trip through ToString
+			for (double value = 1e-300; value < 1e300; value *= 1.7e7) {
+				double parsed;
+				Assert::IsTrue(Float::TryParse(Float::ToString(value), parsed) && parsed == value, L"TryParse", LINE_INFO());
+				Assert::IsTrue(Float::TryParse(Float::ToString(-value), parsed) && parsed == -value, L"TryParse", LINE_INFO());
+			}
+		}
+
+		TEST_METHOD(FloatParseColumnTest)
+		{
+			// variables
+			Vector<double> values;
+			Vector<float> floats;
+			Vector<int> errors;
+			String line;
+
+			// invalid fields get zero and are reported by index
+			Assert::IsFalse(Float::ParseColumn("1.5|-2e3||abc|inf|.25", '|', values, errors), L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(6, (int)values.Length, L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(2, (int)errors.Length, L"ParseColumn", LINE_INFO());
+			Assert::IsTrue(values[0] == 1.5 && values[1] == -2000.0 && values[2] == 0.0, L"ParseColumn", LINE_INFO());
+			Assert::IsTrue(values[4] == std::numeric_limits<double>::infinity() && values[5] == 0.25, L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(2, errors[0], L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(3, errors[1], L"ParseColumn", LINE_INFO());
+
+			// the delimiter may be part of a number elsewhere
+			Assert::IsTrue(Float::ParseColumn("1e5e-3e", 'e', floats, errors) == false, L"ParseColumn", LINE_INFO());
+			Assert::IsTrue(floats[0] == 1.0f && floats[1] == 5.0f && floats[2] == -3.0f, L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(3, errors[2], L"ParseColumn", LINE_INFO());
+
+			// long lines round trip
+			for (int i = 0; i < 500; i++) {
+				Float::AppendTo(line, i / 7.0);
+
+				if (i < 499) {
+					line.Append(",");
+				}
+			}
+
+			values.Clear();
+			Assert::IsTrue(Float::ParseColumn(line, ',', values, errors), L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(500, (int)values.Length, L"ParseColumn", LINE_INFO());
+
+			for (int i = 0; i < 500; i++) {
+				Assert::IsTrue(values[i] == i / 7.0, L"ParseColumn", LINE_INFO());
+			}
+		}
 	};
 }
@@ -19,6 +19,7 @@
 #include "CppUnitTest.h"
 #include "..\Framework\String.hpp"
 #include "..\Framework\Integer.hpp"
+#include "..\Framework\Vector.hpp"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Lupus;
@@ -69,6 +70,58 @@ namespace FrameworkTest {
 			Assert::IsTrue(String("0x7f").Compare(Integer::ToString((ullong)value, IntegerBase::Hexadecimal)) == 0, L"ToString", LINE_INFO());
 		}
 
+		TEST_METHOD(IntegerFormatToTest)
+		{
+			// variables
+			char buffer[Integer::MaxFormatLength];
+
+			// decimal
+			Assert::AreEqual(1, Integer::FormatTo(buffer, 0), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "0", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(4, Integer::FormatTo(buffer, (sbyte)-128), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "-128", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(11, Integer::FormatTo(buffer, (int)0x80000000), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "-2147483648", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(20, Integer::FormatTo(buffer, (llong)0x8000000000000000ULL), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "-9223372036854775808", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(20, Integer::FormatTo(buffer, (ullong)-1), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "18446744073709551615", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(13, Integer::FormatTo(buffer, (ullong)1000000000007ULL), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "1000000000007", L"FormatTo", LINE_INFO());
+
+			// hexadecimal, negative values within their own width
+			Assert::AreEqual(1, Integer::FormatTo(buffer, 0, IntegerBase::Hexadecimal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "0", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(3, Integer::FormatTo(buffer, 15, IntegerBase::Hexadecimal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "0xf", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(4, Integer::FormatTo(buffer, (sbyte)-1, IntegerBase::Hexadecimal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "0xff", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(6, Integer::FormatTo(buffer, (short)-2, IntegerBase::Hexadecimal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "0xfffe", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(18, Integer::FormatTo(buffer, (ullong)0x123456789abcdef0ULL, IntegerBase::Hexadecimal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "0x123456789abcdef0", L"FormatTo", LINE_INFO());
+
+			// octal
+			Assert::AreEqual(1, Integer::FormatTo(buffer, 0, IntegerBase::Octal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "0", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(3, Integer::FormatTo(buffer, 8, IntegerBase::Octal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "010", L"FormatTo", LINE_INFO());
+			Assert::AreEqual(23, Integer::FormatTo(buffer, (ullong)-1, IntegerBase::Octal), L"FormatTo", LINE_INFO());
+			Assert::IsTrue(String(buffer) == "01777777777777777777777", L"FormatTo", LINE_INFO());
+		}
+
+		TEST_METHOD(IntegerAppendToTest)
+		{
+			// variables
+			String string("value=");
+
+			// append without temporary strings
+			Assert::IsTrue(&Integer::AppendTo(string, -42) == &string, L"AppendTo", LINE_INFO());
+			Assert::IsTrue(string == "value=-42", L"AppendTo", LINE_INFO());
+			Integer::AppendTo(Integer::AppendTo(string.Append(","), (ushort)255, IntegerBase::Hexadecimal).Append(","), 8u, IntegerBase::Octal);
+			Assert::IsTrue(string == "value=-42,0xff,010", L"AppendTo", LINE_INFO());
+		}
+
 		TEST_METHOD(IntegerTryParseTest)
 		{
 			// variables
@@ -124,5 +177,116 @@ namespace FrameworkTest {
 			Assert::IsTrue(Integer::TryParse(oct, lu, IntegerBase::Octal) && lu == 1, L"TryParse", LINE_INFO());
 			Assert::IsTrue(Integer::TryParse(oct, llu, IntegerBase::Octal) && llu == 1, L"TryParse", LINE_INFO());
 		}
+
+		TEST_METHOD(IntegerTryParseStrictTest)
+		{
+			// variables
+			sbyte hhd = 0;
+			int d = 0;
+			llong lld = 0;
+			ubyte hhu = 0;
+			uint u = 0;
+			ullong llu = 0;
+
+			// limits of every type
+			Assert::IsTrue(Integer::TryParse("-128", hhd) && hhd == -128, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("128", hhd), L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse("+2147483647", d) && d == 2147483647, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("2147483648", d), L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse("-9223372036854775808", lld) && lld == (llong)0x8000000000000000ULL, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("9223372036854775808", lld), L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse("18446744073709551615", llu) && llu == 18446744073709551615ULL, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("18446744073709551616", llu), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("99999999999999999999999", llu), L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse("0000000000000000000000000042", llu) && llu == 42, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse("1234567890123456789", llu) && llu == 1234567890123456789ULL, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("256", hhu), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("-1", u), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("0x100", hhu, IntegerBase::Hexadecimal), L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse("FFFFFFFF", u, IntegerBase::Hexadecimal) && u == 0xffffffff, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("400", hhu, IntegerBase::Octal), L"TryParse", LINE_INFO());
+
+			// garbage and empty strings leave the result untouched
+			d = 7;
+			Assert::IsFalse(Integer::TryParse("12a", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse(" 12", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("-", d), L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("0x", d, IntegerBase::Hexadecimal), L"TryParse", LINE_INFO());
+			Assert::AreEqual(7, d, L"TryParse", LINE_INFO());
+		}
+
+		TEST_METHOD(IntegerTryParseConsumedTest)
+		{
+			// variables
+			const char* text = "12345678901234,-17,0x1fz,0xg";
+			int consumed = 0;
+			llong lld = 0;
+			int d = 0;
+
+			// numbers within a larger buffer
+			Assert::IsTrue(Integer::TryParse(text, lld, consumed) && lld == 12345678901234LL, L"TryParse", LINE_INFO());
+			Assert::AreEqual(14, consumed, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse(text + 15, d, consumed) && d == -17, L"TryParse", LINE_INFO());
+			Assert::AreEqual(3, consumed, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse(text + 19, d, consumed, IntegerBase::Hexadecimal) && d == 0x1f, L"TryParse", LINE_INFO());
+			Assert::AreEqual(4, consumed, L"TryParse", LINE_INFO());
+			Assert::IsTrue(Integer::TryParse(text + 25, d, consumed, IntegerBase::Hexadecimal) && d == 0, L"TryParse", LINE_INFO());
+			Assert::AreEqual(1, consumed, L"TryParse", LINE_INFO());
+
+			// failures consume nothing
+			Assert::IsFalse(Integer::TryParse(",1", d, consumed), L"TryParse", LINE_INFO());
+			Assert::AreEqual(0, consumed, L"TryParse", LINE_INFO());
+			Assert::IsFalse(Integer::TryParse("99999999999,", d, consumed), L"TryParse", LINE_INFO());
+			Assert::AreEqual(0, consumed, L"TryParse", LINE_INFO());
+		}
+
+		TEST_METHOD(IntegerParseColumnTest)
+		{
+			// variables
+			Vector<int> values;
+			Vector<int> errors;
+			Vector<ubyte> bytes;
+			String line;
+
+			// invalid fields get zero and are reported by index
+			Assert::IsFalse(Integer::ParseColumn("1,22,-3,x,,0x10,7", ',', values, errors), L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(7, (int)values.Length, L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(3, (int)errors.Length, L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(-3, values[2], L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(0, values[5], L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(7, values[6], L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(3, errors[0], L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(4, errors[1], L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(5, errors[2], L"ParseColumn", LINE_INFO());
+
+			// further lines are appended, empty lines have no fields
+			Assert::IsTrue(Integer::ParseColumn("5;6", ';', values, errors), L"ParseColumn", LINE_INFO());
+			Assert::IsTrue(Integer::ParseColumn("", ';', values, errors), L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(9, (int)values.Length, L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(6, values[8], L"ParseColumn", LINE_INFO());
+			Assert::IsFalse(Integer::ParseColumn("8,", ',', values, errors), L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(10, errors[3], L"ParseColumn", LINE_INFO());
+
+			// other bases and long lines
+			Assert::IsTrue(Integer::ParseColumn("ff\t0x10\t7", '\t', bytes, errors, IntegerBase::Hexadecimal), L"ParseColumn", LINE_INFO());
+			Assert::IsTrue(bytes[0] == 255 && bytes[1] == 16 && bytes[2] == 7, L"ParseColumn", LINE_INFO());
+
+			for (int i = 0; i < 1000; i++) {
+				Integer::AppendTo(line, i * 7);
+
+				if (i < 999) {
+					line.Append(",");
+				}
+			}
+
+			values.Clear();
+			Assert::IsTrue(Integer::ParseColumn(line, ',', values, errors), L"ParseColumn", LINE_INFO());
+			Assert::AreEqual(1000, (int)values.Length, L"ParseColumn", LINE_INFO());
+
+			for (int i = 0; i < 1000; i++) {
+				Assert::AreEqual(i * 7, values[i], L"ParseColumn", LINE_INFO());
+			}
+		}
 	};
 }
@@ -0,0 +1,131 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "..\Framework\SharedString.hpp"
+#include "..\Framework\StringView.hpp"
+#include "..\Framework\String.hpp"
+#include "..\Framework\Exception.hpp"
+#include <utility>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	TEST_CLASS(SharedStringTest)
+	{
+		TEST_METHOD(SharedStringConstructorTest)
+		{
+			// variables
+			String string("ABCdef");
+			SharedString empty;
+
+			// construct
+			Assert::IsTrue(empty.IsEmpty(), L"()", LINE_INFO());
+			Assert::AreEqual('\0', empty.Data()[0], L"()", LINE_INFO());
+			Assert::AreEqual(6, SharedString("ABCdef").Length(), L"(const char*)", LINE_INFO());
+			Assert::IsTrue(SharedString(string).ToString() == string, L"(const StringView&)", LINE_INFO());
+			Assert::IsTrue(SharedString(StringView("ABCdef", 3)).View() == "ABC", L"(const StringView&)", LINE_INFO());
+			Assert::AreEqual('\0', SharedString(StringView("ABCdef", 3)).Data()[3], L"Data", LINE_INFO());
+			Assert::ExpectException<ArgumentNullException>([]() { SharedString(static_cast<const char*>(nullptr)); }, L"(nullptr)", LINE_INFO());
+			Assert::IsTrue(SharedString("").IsEmpty(), L"(\"\")", LINE_INFO());
+		}
+
+		TEST_METHOD(SharedStringCopyTest)
+		{
+			// variables
+			SharedString first("ABCdef");
+			SharedString second(first);
+			SharedString third;
+
+			// copies share the chars
+			Assert::IsTrue(first.Data() == second.Data(), L"(const SharedString&)", LINE_INFO());
+			Assert::IsFalse(first.IsUnique(), L"IsUnique", LINE_INFO());
+			third = second;
+			Assert::IsTrue(third.Data() == first.Data(), L"operator=", LINE_INFO());
+			third = third;
+			Assert::IsTrue(third.Data() == first.Data(), L"operator=", LINE_INFO());
+
+			// moves take over the chars
+			const char* data = first.Data();
+			SharedString moved(std::move(third));
+			Assert::IsTrue(moved.Data() == data, L"(SharedString&&)", LINE_INFO());
+			Assert::IsTrue(third.IsEmpty(), L"(SharedString&&)", LINE_INFO());
+			third = std::move(moved);
+			Assert::IsTrue(third.Data() == data, L"operator=(SharedString&&)", LINE_INFO());
+			Assert::IsTrue(moved.IsEmpty(), L"operator=(SharedString&&)", LINE_INFO());
+
+			// released references
+			second = SharedString();
+			third = SharedString();
+			Assert::IsTrue(first.IsUnique(), L"IsUnique", LINE_INFO());
+			Assert::IsTrue(first.View() == "ABCdef", L"View", LINE_INFO());
+		}
+
+		TEST_METHOD(SharedStringModifyTest)
+		{
+			// variables
+			SharedString first("ABCdef");
+			SharedString second(first);
+			const char* data = first.Data();
+
+			// shared chars are copied before modification
+			second.ToUpper();
+			Assert::IsTrue(second.View() == "ABCDEF", L"ToUpper", LINE_INFO());
+			Assert::IsTrue(first.View() == "ABCdef", L"ToUpper", LINE_INFO());
+			Assert::IsTrue(first.Data() == data, L"ToUpper", LINE_INFO());
+			Assert::IsTrue(first.IsUnique() && second.IsUnique(), L"IsUnique", LINE_INFO());
+
+			// unique chars are modified in place
+			first.ToLower();
+			Assert::IsTrue(first.View() == "abcdef", L"ToLower", LINE_INFO());
+			Assert::IsTrue(first.Data() == data, L"ToLower", LINE_INFO());
+
+			// transform
+			ubyte table[256];
+			for (int i = 0; i < 256; i++) {
+				table[i] = static_cast<ubyte>(i == 'a' ? 'z' : i);
+			}
+			Assert::IsTrue(SharedString("banana").Transform(table).View() == "bznznz", L"Transform", LINE_INFO());
+			Assert::IsTrue(SharedString().ToLower().IsEmpty(), L"ToLower", LINE_INFO());
+			Assert::ExpectException<ArgumentNullException>([&]() { first.Transform(nullptr); }, L"Transform(nullptr)", LINE_INFO());
+		}
+
+		TEST_METHOD(SharedStringCompareTest)
+		{
+			// variables
+			SharedString first("ABCdef");
+			SharedString second("ABCdef");
+
+			// compare
+			Assert::IsTrue(first == second, L"==", LINE_INFO());
+			Assert::IsTrue(first == SharedString(first), L"==", LINE_INFO());
+			Assert::IsTrue(first != SharedString("ABCdeF"), L"!=", LINE_INFO());
+			Assert::IsTrue(SharedString() == SharedString(""), L"==", LINE_INFO());
+			Assert::AreEqual('C', first[2], L"operator[]", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { first[6]; }, L"operator[]", LINE_INFO());
+
+			// hash
+			Assert::IsTrue(first.GetHashCode() == second.GetHashCode(), L"GetHashCode", LINE_INFO());
+			Assert::IsTrue(first.GetHashCode() == StringView("ABCdef").GetHashCode(), L"GetHashCode", LINE_INFO());
+			Assert::IsTrue(first.GetHashCode(CaseSensitivity::CaseInsensitive) == SharedString("abcDEF").GetHashCode(CaseSensitivity::CaseInsensitive), L"GetHashCode", LINE_INFO());
+		}
+	};
+}
@@ -0,0 +1,87 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "..\Framework\Char.hpp"
+#include "..\Framework\String.hpp"
+#include "..\Framework\StringBuilder.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	TEST_CLASS(StringBuilderTest)
+	{
+		TEST_METHOD(StringBuilderAppendTest)
+		{
+			// variables
+			StringBuilder builder;
+
+			// empty builder
+			Assert::AreEqual(0, (int)builder.Length, L"StringBuilder()", LINE_INFO());
+			Assert::IsTrue(builder.ToString() == "", L"StringBuilder()", LINE_INFO());
+
+			// append
+			builder.Append("abc").Append(String("def")).Append(Char('g')).Append("hijk", 2);
+			Assert::AreEqual(9, (int)builder.Length, L"Append", LINE_INFO());
+			Assert::IsTrue(builder.ToString() == "abcdefghi", L"Append", LINE_INFO());
+
+			// clear
+			builder.Clear();
+			Assert::AreEqual(0, (int)builder.Length, L"Clear", LINE_INFO());
+			Assert::IsTrue(builder.ToString() == "", L"Clear", LINE_INFO());
+		}
+
+		TEST_METHOD(StringBuilderChunkTest)
+		{
+			// variables
+			StringBuilder builder(4);
+			String expected;
+
+			// content spanning several blocks
+			for (int i = 0; i < 1000; i++) {
+				builder.Append("0123456789");
+				expected += "0123456789";
+			}
+
+			Assert::AreEqual(10000, (int)builder.Length, L"Append", LINE_INFO());
+			Assert::IsTrue(builder.ToString() == expected, L"ToString", LINE_INFO());
+		}
+
+		TEST_METHOD(StringBuilderAppendFormatTest)
+		{
+			// variables
+			StringBuilder builder;
+
+			// integer
+			builder.AppendFormat(-127).Append(' ').AppendFormat(127, IntegerBase::Octal).Append(' ').AppendFormat((ullong)127, IntegerBase::Hexadecimal);
+			Assert::IsTrue(builder.ToString() == "-127 0177 0x7f", L"AppendFormat", LINE_INFO());
+			builder.Clear();
+			builder.AppendFormat(-9223372036854775807LL - 1).Append(' ').AppendFormat((sbyte)-1, IntegerBase::Hexadecimal).Append(' ').AppendFormat(0, IntegerBase::Octal);
+			Assert::IsTrue(builder.ToString() == "-9223372036854775808 0xff 0", L"AppendFormat", LINE_INFO());
+
+			// floating-point
+			builder.Clear();
+			builder.AppendFormat(1.5).Append(' ').AppendFormat(0.1f).Append(' ').AppendFormat(2.675, FloatFormat::Fixed, 2);
+			Assert::IsTrue(builder.ToString() == "1.5 0.1 2.67", L"AppendFormat", LINE_INFO());
+			Assert::IsTrue(StringBuilder().AppendFormat(1e-7).ToString() == Float::ToString(1e-7), L"AppendFormat", LINE_INFO());
+		}
+	};
+}
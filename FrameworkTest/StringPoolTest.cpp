@@ -0,0 +1,154 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "..\Framework\StringPool.hpp"
+#include "..\Framework\StringView.hpp"
+#include "..\Framework\String.hpp"
+#include "..\Framework\Integer.hpp"
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	TEST_CLASS(StringPoolTest)
+	{
+		TEST_METHOD(StringPoolInternTest)
+		{
+			// variables
+			String name("StringPoolInternTest.Name");
+			char copy[] = "StringPoolInternTest.Name";
+			InternedString first = StringPool::Intern(name);
+			InternedString second = StringPool::Intern(copy);
+			InternedString other = StringPool::Intern("StringPoolInternTest.Other");
+
+			// equal chars share one entry
+			Assert::IsTrue(first == second, L"==", LINE_INFO());
+			Assert::IsTrue(first.Data() == second.Data(), L"Data", LINE_INFO());
+			Assert::IsTrue(first != other, L"!=", LINE_INFO());
+			Assert::IsTrue(first.Data() != name.Data, L"Data", LINE_INFO());
+
+			// content
+			Assert::AreEqual(25, first.Length(), L"Length", LINE_INFO());
+			Assert::AreEqual('\0', first.Data()[first.Length()], L"Data", LINE_INFO());
+			Assert::IsTrue(first.View() == StringView(name), L"View", LINE_INFO());
+			Assert::IsTrue(first.ToString() == name, L"ToString", LINE_INFO());
+			Assert::IsTrue(first.GetHashCode() == StringView(name).GetHashCode(), L"GetHashCode", LINE_INFO());
+			Assert::IsTrue(first.GetHashCode() == second.GetHashCode(), L"GetHashCode", LINE_INFO());
+
+			// handles survive the interned string
+			name = "changed";
+			Assert::IsTrue(StringPool::Intern(copy) == first, L"Intern", LINE_INFO());
+
+			// case matters
+			Assert::IsTrue(StringPool::Intern("stringpoolinterntest.name") != first, L"Intern", LINE_INFO());
+
+			// empty
+			Assert::IsTrue(StringPool::Intern("") == InternedString(), L"Intern(\"\")", LINE_INFO());
+			Assert::IsTrue(InternedString().IsEmpty(), L"IsEmpty", LINE_INFO());
+			Assert::IsTrue(InternedString().ToString() == "", L"ToString", LINE_INFO());
+			Assert::AreEqual('\0', InternedString().Data()[0], L"Data", LINE_INFO());
+			Assert::IsTrue(InternedString().GetHashCode() == StringView("").GetHashCode(), L"GetHashCode", LINE_INFO());
+		}
+
+		TEST_METHOD(StringPoolTryGetTest)
+		{
+			// variables
+			InternedString result;
+			int count = StringPool::Count();
+
+			// lookup doesn't add
+			Assert::IsFalse(StringPool::TryGet("StringPoolTryGetTest.Missing", result), L"TryGet", LINE_INFO());
+			Assert::IsTrue(result == InternedString(), L"TryGet", LINE_INFO());
+			Assert::AreEqual(count, StringPool::Count(), L"Count", LINE_INFO());
+
+			// interning adds exactly once
+			InternedString interned = StringPool::Intern("StringPoolTryGetTest.Missing");
+			StringPool::Intern(StringView("StringPoolTryGetTest.Missing!", 28));
+			Assert::AreEqual(count + 1, StringPool::Count(), L"Count", LINE_INFO());
+			Assert::IsTrue(StringPool::TryGet("StringPoolTryGetTest.Missing", result), L"TryGet", LINE_INFO());
+			Assert::IsTrue(result == interned, L"TryGet", LINE_INFO());
+		}
+
+		TEST_METHOD(StringPoolGrowTest)
+		{
+			// variables
+			const int count = 5000;
+			InternedString* handles = new InternedString[count];
+
+			// force every shard to grow several times
+			for (int i = 0; i < count; i++) {
+				handles[i] = StringPool::Intern("StringPoolGrowTest." + Integer::ToString(i));
+			}
+
+			for (int i = 0; i < count; i++) {
+				String name = "StringPoolGrowTest." + Integer::ToString(i);
+				Assert::IsTrue(StringPool::Intern(name) == handles[i], L"Intern", LINE_INFO());
+				Assert::IsTrue(handles[i].ToString() == name, L"ToString", LINE_INFO());
+			}
+
+			delete[] handles;
+		}
+
+		TEST_METHOD(StringPoolThreadTest)
+		{
+			// variables
+			const int threadCount = 4;
+			const int count = 2048;
+			InternedString* handles = new InternedString[threadCount * count];
+			bool found[threadCount] = { };
+			std::thread threads[threadCount];
+			int before = StringPool::Count();
+
+			// every thread interns the same names, odd strides give each thread a different order
+			for (int t = 0; t < threadCount; t++) {
+				threads[t] = std::thread([=, &found]() {
+					InternedString result;
+
+					for (int i = 0; i < count; i++) {
+						int index = (i * (2 * t + 1)) % count;
+						handles[t * count + index] = StringPool::Intern("StringPoolThreadTest." + Integer::ToString(index));
+					}
+
+					found[t] = StringPool::TryGet("StringPoolThreadTest.0", result) && result == handles[t * count];
+				});
+			}
+
+			for (int t = 0; t < threadCount; t++) {
+				threads[t].join();
+			}
+
+			// each name was added once and all threads got the same handle
+			Assert::AreEqual(before + count, StringPool::Count(), L"Count", LINE_INFO());
+
+			for (int t = 0; t < threadCount; t++) {
+				Assert::IsTrue(found[t], L"TryGet", LINE_INFO());
+
+				for (int i = 0; i < count; i++) {
+					Assert::IsTrue(handles[t * count + i] == handles[i], L"Intern", LINE_INFO());
+				}
+			}
+
+			Assert::IsTrue(handles[7].ToString() == "StringPoolThreadTest.7", L"ToString", LINE_INFO());
+			delete[] handles;
+		}
+	};
+}
@@ -0,0 +1,109 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "..\Framework\String.hpp"
+#include "..\Framework\StringSplitter.hpp"
+#include "..\Framework\Exception.hpp"
+#include "..\Framework\Vector.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	namespace {
+		// compare lazy tokens with the tokens of the eager split
+		void CheckTokens(const Vector<String>& expected, const StringSplitter& splitter, const wchar_t* message)
+		{
+			// variables
+			int index = 0;
+
+			foreach(token, splitter) {
+				Assert::IsTrue(index < expected.Length, message, LINE_INFO());
+				Assert::IsTrue(token->CurrentItem().ToString() == expected[index], message, LINE_INFO());
+				index++;
+			}
+
+			Assert::AreEqual((int)expected.Length, index, message, LINE_INFO());
+		}
+	}
+
+	TEST_CLASS(StringSplitterTest)
+	{
+		TEST_METHOD(StringSplitterCharSetTest)
+		{
+			// variables
+			String string("ABCDABCDABCD");
+			String separated("a, b;;c\td,");
+			Vector<char> delimiter = { 'A', 'B' };
+			CharSet chars(" \t,;");
+
+			// same tokens as eager split
+			CheckTokens(string.Split(delimiter), string.SplitLazy(CharSet(delimiter)), L"SplitLazy(CharSet)");
+			CheckTokens(string.Split(delimiter, 3), string.SplitLazy(CharSet(delimiter), 3), L"SplitLazy(CharSet, int)");
+			CheckTokens(separated.Split(chars), separated.SplitLazy(chars), L"SplitLazy(CharSet)");
+			CheckTokens(separated.Split(chars, StringSplitOptions::RemoveEmptyEntries), separated.SplitLazy(chars, StringSplitOptions::RemoveEmptyEntries), L"RemoveEmptyEntries");
+			CheckTokens(separated.Split(chars, 3, StringSplitOptions::RemoveEmptyEntries), separated.SplitLazy(chars, 3, StringSplitOptions::RemoveEmptyEntries), L"RemoveEmptyEntries");
+			CheckTokens(string.Split(chars), string.SplitLazy(chars), L"no delimiter");
+		}
+
+		TEST_METHOD(StringSplitterStringTest)
+		{
+			// variables
+			String string("one, two, , three, ");
+			Pointer<CompiledPattern> pattern = String::Compile(", ");
+
+			// same tokens as eager split
+			CheckTokens(string.Split(String(", ")), string.SplitLazy(", "), L"SplitLazy(StringView)");
+			CheckTokens(string.Split(String(", "), 2), string.SplitLazy(", ", 2), L"SplitLazy(StringView, int)");
+			CheckTokens(string.Split(*pattern, StringSplitOptions::RemoveEmptyEntries), string.SplitLazy(*pattern, StringSplitOptions::RemoveEmptyEntries), L"SplitLazy(CompiledPattern)");
+			CheckTokens(string.Split(*pattern, 3), string.SplitLazy(*pattern, 3), L"SplitLazy(CompiledPattern, int)");
+		}
+
+		TEST_METHOD(StringSplitterIteratorTest)
+		{
+			// variables
+			String string("a,b,c");
+			StringSplitter splitter = string.SplitLazy(CharSet(","));
+			Pointer<Iterator<StringView>> iterator = splitter.GetIterator();
+			const char* first = nullptr;
+
+			// tokens are views onto the string
+			first = iterator->CurrentItem().Data();
+			Assert::IsTrue(first == string.Data, L"CurrentItem", LINE_INFO());
+			iterator->Next();
+			iterator->Next();
+			Assert::IsTrue(iterator->CurrentItem() == "c", L"Next", LINE_INFO());
+			iterator->Next();
+			Assert::IsTrue(iterator->IsDone(), L"IsDone", LINE_INFO());
+			Assert::ExpectException<IteratorOutOfBoundException>([&]() { iterator->CurrentItem(); }, L"CurrentItem", LINE_INFO());
+
+			// restart
+			iterator->First();
+			Assert::IsTrue(iterator->CurrentItem() == "a", L"First", LINE_INFO());
+
+			// raw buffer
+			CheckTokens(Vector<String>({ "x", "y" }), StringSplitter(StringView("x;y;z", 3), CharSet(";"), 5), L"StringSplitter(StringView)");
+			CheckTokens(Vector<String>(), string.SplitLazy(CharSet(","), 0), L"count");
+			Assert::IsTrue(string.SplitLazy(", ", 0).GetIterator()->IsDone(), L"count", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { string.SplitLazy(CharSet(","), -1); }, L"count", LINE_INFO());
+		}
+	};
+}
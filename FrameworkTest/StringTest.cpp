@@ -19,6 +19,7 @@
 #include "CppUnitTest.h"
 #include "..\Framework\Char.hpp"
 #include "..\Framework\String.hpp"
+#include "..\Framework\CharSet.hpp"
 #include "..\Framework\Exception.hpp"
 #include "..\Framework\Vector.hpp"
 
@@ -28,6 +29,14 @@ using namespace Lupus::System;
 
 namespace FrameworkTest
 {
+	//! finds nothing, so searches show which algorithm ran
+	class NeverFound : public ITextSearchStrategy
+	{
+	public:
+		virtual int Search(const char*, int, const char*, int, CaseSensitivity) const override { return -1; }
+		virtual Pointer<ITextSearchStrategy> Copy() const override { return new NeverFound(); }
+	};
+
 	TEST_CLASS(StringTest)
 	{
 	public:
@@ -41,21 +50,25 @@ namespace FrameworkTest
 
 			// (const char*) constructor
 			Assert::AreEqual(3, (int)String("abc").Length, L"(const char*) constructor", LINE_INFO());
-			Assert::AreEqual(3, (int)String("abc").Capacity, L"(const char*) constructor", LINE_INFO());
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)String("abc").Capacity, L"(const char*) constructor", LINE_INFO());
 			Assert::AreEqual('a', String("abc")[0], L"(const char*) constructor", LINE_INFO());
 			Assert::AreEqual('b', String("abc")[1], L"(const char*) constructor", LINE_INFO());
 			Assert::AreEqual('c', String("abc")[2], L"(const char*) constructor", LINE_INFO());
 
 			// (const wchar_t*) constructor
 			Assert::AreEqual(3, (int)String(L"abc").Length, L"(const wchar_t*) constructor", LINE_INFO());
-			Assert::AreEqual(3, (int)String(L"abc").Capacity, L"(const char*) constructor", LINE_INFO());
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)String(L"abc").Capacity, L"(const char*) constructor", LINE_INFO());
 			Assert::AreEqual('a', String(L"abc")[0], L"(const wchar_t*) constructor", LINE_INFO());
 			Assert::AreEqual('b', String(L"abc")[1], L"(const wchar_t*) constructor", LINE_INFO());
 			Assert::AreEqual('c', String(L"abc")[2], L"(const wchar_t*) constructor", LINE_INFO());
+			Assert::IsTrue(String(L"\x00e4\x20ac") == "\xc3\xa4\xe2\x82\xac", L"(const wchar_t*) constructor", LINE_INFO());
+			Assert::IsTrue(String(L"\U0001f600") == "\xf0\x9f\x98\x80", L"(const wchar_t*) constructor", LINE_INFO());
+			Assert::AreEqual(0, (int)String(L"").Length, L"(const wchar_t*) constructor", LINE_INFO());
+			Assert::ExpectException<EncodingException>([]() { String(L"a\xd800"); }, L"(const wchar_t*) constructor", LINE_INFO());
 
 			// (const Char*) constructor
 			Assert::AreEqual(6, (int)String(ch).Length, L"(const Char*) constructor", LINE_INFO());
-			Assert::AreEqual(6, (int)String(ch).Capacity, L"(const char*) constructor", LINE_INFO());
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)String(ch).Capacity, L"(const char*) constructor", LINE_INFO());
 			Assert::AreEqual('a', String(ch)[0], L"(const Char*) constructor", LINE_INFO());
 			Assert::AreEqual('b', String(ch)[1], L"(const Char*) constructor", LINE_INFO());
 			Assert::AreEqual('c', String(ch)[2], L"(const Char*) constructor", LINE_INFO());
@@ -65,23 +78,54 @@ namespace FrameworkTest
 
 			// (const char*,int,int) constructor
 			Assert::AreEqual(2, (int)String("abcdef", 2, 2).Length, L"(const wchar_t*, int, int) constructor", LINE_INFO());
-			Assert::AreEqual(2, (int)String("abcdef", 2, 2).Capacity, L"(const wchar_t*, int, int) constructor", LINE_INFO());
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)String("abcdef", 2, 2).Capacity, L"(const wchar_t*, int, int) constructor", LINE_INFO());
 			Assert::AreEqual('c', String("abcdef", 2, 2)[0], L"(const wchar_t*, int, int) constructor", LINE_INFO());
 			Assert::AreEqual('d', String("abcdef", 2, 2)[1], L"(const wchar_t*, int, int) constructor", LINE_INFO());
 
 			// (const wchar_t*,int,int) constructor
 			Assert::AreEqual(2, (int)String(L"abcdef", 2, 2).Length, L"(const wchar_t*, int, int) constructor", LINE_INFO());
-			Assert::AreEqual(2, (int)String(L"abcdef", 2, 2).Capacity, L"(const wchar_t*, int, int) constructor", LINE_INFO());
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)String(L"abcdef", 2, 2).Capacity, L"(const wchar_t*, int, int) constructor", LINE_INFO());
 			Assert::AreEqual('c', String(L"abcdef", 2, 2)[0], L"(const wchar_t*, int, int) constructor", LINE_INFO());
 			Assert::AreEqual('d', String(L"abcdef", 2, 2)[1], L"(const wchar_t*, int, int) constructor", LINE_INFO());
 
 			// (const Char*,int,int) constructor
 			Assert::AreEqual(2, (int)String(ch, 2, 2).Length, L"(const wchar_t*, int, int) constructor", LINE_INFO());
-			Assert::AreEqual(2, (int)String(ch, 2, 2).Capacity, L"(const wchar_t*, int, int) constructor", LINE_INFO());
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)String(ch, 2, 2).Capacity, L"(const wchar_t*, int, int) constructor", LINE_INFO());
 			Assert::AreEqual('c', String(ch, 2, 2)[0], L"(const wchar_t*, int, int) constructor", LINE_INFO());
 			Assert::AreEqual('d', String(ch, 2, 2)[1], L"(const wchar_t*, int, int) constructor", LINE_INFO());
 		}
 
+		TEST_METHOD(StringSmallStringTest)
+		{
+			// variables
+			String small("abc");
+			String large("abcdefghijklmnopqrstuvwxyz0123456789");
+
+			// short strings use the inline buffer
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)small.Capacity, L"inline capacity", LINE_INFO());
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)String(small).Capacity, L"inline copy", LINE_INFO());
+
+			// long strings are stored on the heap
+			Assert::AreEqual(36, (int)large.Length, L"heap length", LINE_INFO());
+			Assert::AreEqual(36, (int)large.Capacity, L"heap capacity", LINE_INFO());
+
+			// move keeps content for both storage types
+			String movedSmall(std::move(small));
+			String movedLarge(std::move(large));
+			Assert::IsTrue(movedSmall == "abc", L"inline move", LINE_INFO());
+			Assert::IsTrue(movedLarge == "abcdefghijklmnopqrstuvwxyz0123456789", L"heap move", LINE_INFO());
+
+			// growing past the inline buffer
+			movedSmall += "defghijklmnopqrstuvwxyz0123456789";
+			Assert::IsTrue(movedSmall == movedLarge, L"inline to heap", LINE_INFO());
+
+			// shrinking back into the inline buffer
+			movedLarge.Remove(3);
+			movedLarge.ShrinkToFit();
+			Assert::AreEqual(DEFAULT_ARRAY_SIZE - 1, (int)movedLarge.Capacity, L"heap to inline", LINE_INFO());
+			Assert::IsTrue(movedLarge == "abc", L"heap to inline", LINE_INFO());
+		}
+
 		TEST_METHOD(StringAppendTest)
 		{
 			// variables
@@ -107,6 +151,82 @@ namespace FrameworkTest
 			Assert::AreEqual('f', string[5], L"Append", LINE_INFO());
 		}
 
+		TEST_METHOD(StringReserveTest)
+		{
+			// variables
+			String string;
+
+			// reserve
+			string.Reserve(100);
+			Assert::AreEqual(100, (int)string.Capacity, L"Reserve", LINE_INFO());
+			Assert::AreEqual(0, (int)string.Length, L"Reserve", LINE_INFO());
+
+			// appending within capacity keeps the buffer
+			for (int i = 0; i < 100; i++) {
+				string += Char('a');
+			}
+
+			Assert::AreEqual(100, (int)string.Length, L"Append", LINE_INFO());
+			Assert::AreEqual(100, (int)string.Capacity, L"Append", LINE_INFO());
+
+			// growing doubles capacity
+			string.Append("bc", 2);
+			Assert::AreEqual(102, (int)string.Length, L"Append", LINE_INFO());
+			Assert::AreEqual(200, (int)string.Capacity, L"Append", LINE_INFO());
+			Assert::AreEqual('c', string.Back(), L"Append", LINE_INFO());
+
+			// appending to itself
+			string = "abc";
+			string += string;
+			Assert::IsTrue(string == "abcabc", L"Append self", LINE_INFO());
+
+			// insert
+			string.Insert(0, 'x');
+			Assert::IsTrue(string == "xabcabc", L"Insert", LINE_INFO());
+		}
+
+		TEST_METHOD(StringGetHashCodeTest)
+		{
+			// variables
+			const char* text = "The quick brown fox jumps over the lazy dog, THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG";
+			String string("ABCdef");
+			String copy(string);
+
+			// equal content, equal hash code
+			Assert::IsTrue(string.GetHashCode() == copy.GetHashCode(), L"copy", LINE_INFO());
+			Assert::IsTrue(string.GetHashCode() == String("ABC").Append("def").GetHashCode(), L"Append", LINE_INFO());
+			Assert::IsTrue(string.GetHashCode() != String("ABCdeF").GetHashCode(), L"different", LINE_INFO());
+
+			// cached hash code is reset by modifications
+			copy[5] = 'F';
+			Assert::IsTrue(string.GetHashCode() != copy.GetHashCode(), L"operator[]", LINE_INFO());
+			copy.Replace("F", "f");
+			Assert::IsTrue(string.GetHashCode() == copy.GetHashCode(), L"Replace", LINE_INFO());
+			copy.ToUpper();
+			Assert::IsTrue(string.GetHashCode() != copy.GetHashCode(), L"ToUpper", LINE_INFO());
+
+			// case insensitive
+			Assert::IsTrue(string.GetHashCode(CaseSensitivity::CaseInsensitive) == copy.GetHashCode(CaseSensitivity::CaseInsensitive), L"case insensitive", LINE_INFO());
+			Assert::IsTrue(String("A_").GetHashCode(CaseSensitivity::CaseInsensitive) != String("a\x7f").GetHashCode(CaseSensitivity::CaseInsensitive), L"case insensitive", LINE_INFO());
+
+			// writes through a held reference are seen after hashing
+			char& last = copy[5];
+			ulong before = copy.GetHashCode();
+			last = 'x';
+			Assert::IsTrue(copy.GetHashCode() != before, L"operator[]", LINE_INFO());
+			Assert::IsTrue(copy.GetHashCode() == String("ABCDEx").GetHashCode(), L"operator[]", LINE_INFO());
+
+			// every length up to several rounds
+			for (int i = 0; i < 89; i++) {
+				String lower = String(StringView(text, i)).ToLower();
+				String upper = String(StringView(text, i)).ToUpper();
+
+				Assert::IsTrue(StringView(text, i).GetHashCode() == String(StringView(text, i)).GetHashCode(), L"StringView", LINE_INFO());
+				Assert::IsTrue(lower.GetHashCode(CaseSensitivity::CaseInsensitive) == upper.GetHashCode(CaseSensitivity::CaseInsensitive), L"case insensitive", LINE_INFO());
+				Assert::IsTrue(i == 0 || StringView(text, i).GetHashCode() != StringView(text, i - 1).GetHashCode(), L"length", LINE_INFO());
+			}
+		}
+
 		TEST_METHOD(StringCompareTest)
 		{
 			// variables
@@ -122,6 +242,12 @@ namespace FrameworkTest
 			Assert::IsTrue(string.Compare("abcdef", CaseSensitivity::CaseInsensitive) == 0, L"case insensitive", LINE_INFO());
 			Assert::IsTrue(string.Compare("abcDEF", CaseSensitivity::CaseInsensitive) == 0, L"case insensitive", LINE_INFO());
 			Assert::IsTrue(string.Compare("ABC", CaseSensitivity::CaseInsensitive) != 0, L"case insensitive", LINE_INFO());
+			Assert::IsTrue(string.Compare("abcdeg", CaseSensitivity::CaseInsensitive) < 0, L"case insensitive", LINE_INFO());
+			Assert::IsTrue(String("A_").Compare("aB", CaseSensitivity::CaseInsensitive) < 0, L"case insensitive", LINE_INFO());
+
+			// locale
+			Assert::IsTrue(string.CompareLocale("abcDEF") == 0, L"locale", LINE_INFO());
+			Assert::IsTrue(string.CompareLocale("abcDEG") < 0, L"locale", LINE_INFO());
 		}
 
 		TEST_METHOD(StringContainsTest)
@@ -165,12 +291,86 @@ namespace FrameworkTest
 			Assert::AreEqual(-1, string.IndexOf("cD", 3, CaseSensitivity::CaseInsensitive), L"(String, int) case sensitive", LINE_INFO());
 		}
 
-		TEST_METHOD(StringIndexOfAnyTest)
+		TEST_METHOD(StringTextSearchAlgorithmTest)
 		{
 			// variables
+			static const NeverFound never;
 			String string("ABCdef");
+			String assigned;
+
+			// per instance algorithm
+			string.TextSearchAlgorithm = &never;
+			Assert::AreEqual(-1, string.IndexOf("Cd"), L"TextSearchAlgorithm", LINE_INFO());
+
+			// copies use the default algorithm
+			assigned = string;
+			Assert::AreEqual(2, String(string).IndexOf("Cd"), L"TextSearchAlgorithm copy", LINE_INFO());
+			Assert::AreEqual(2, assigned.IndexOf("Cd"), L"TextSearchAlgorithm assign", LINE_INFO());
+			Assert::AreEqual(2, String(std::move(assigned)).IndexOf("Cd"), L"TextSearchAlgorithm move", LINE_INFO());
+
+			// nullptr restores the default
+			string.TextSearchAlgorithm = nullptr;
+			Assert::AreEqual(2, string.IndexOf("Cd"), L"TextSearchAlgorithm", LINE_INFO());
+
+			// shared default algorithm
+			String::SetDefaultTextSearchAlgorithm(new NeverFound());
+			Assert::AreEqual(-1, String("ABCdef").IndexOf("def"), L"SetDefaultTextSearchAlgorithm", LINE_INFO());
+			String::SetDefaultTextSearchAlgorithm(new KnuthMorrisPratt());
+			Assert::AreEqual(3, String("ABCdef").IndexOf("def"), L"SetDefaultTextSearchAlgorithm", LINE_INFO());
+			Assert::ExpectException<ArgumentNullException>([]() { String::SetDefaultTextSearchAlgorithm(nullptr); }, L"SetDefaultTextSearchAlgorithm", LINE_INFO());
+			Assert::AreEqual(3, String("ABCdef").IndexOf("def"), L"SetDefaultTextSearchAlgorithm", LINE_INFO());
+		}
+
+		TEST_METHOD(StringCompiledPatternTest)
+		{
+			// variables
+			Pointer<CompiledPattern> pattern = String::Compile(", ");
+			Pointer<CompiledPattern> insensitive = String::Compile("AB", CaseSensitivity::CaseInsensitive);
+			String string("one, two, three, ");
+			Vector<String> result;
+
+			// search
+			Assert::AreEqual(2, (int)pattern->Length, L"Length", LINE_INFO());
+			Assert::IsTrue(string.Contains(*pattern), L"Contains", LINE_INFO());
+			Assert::AreEqual(3, string.IndexOf(*pattern), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(8, string.IndexOf(*pattern, 4), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(-1, string.IndexOf(*pattern, 16), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(2, String("xxabAB").IndexOf(*insensitive), L"IndexOf", LINE_INFO());
+
+			// split
+			result = string.Split(*pattern);
+			Assert::AreEqual(4, (int)result.Length, L"Split", LINE_INFO());
+			Assert::IsTrue(result[0] == "one" && result[1] == "two" && result[2] == "three" && result[3] == "", L"Split", LINE_INFO());
+			result = string.Split(*pattern, StringSplitOptions::RemoveEmptyEntries);
+			Assert::AreEqual(3, (int)result.Length, L"Split", LINE_INFO());
+			Assert::IsTrue(result[2] == "three", L"Split", LINE_INFO());
+			Assert::AreEqual(2, (int)String(", ").Split(*pattern).Length, L"Split", LINE_INFO());
+			Assert::AreEqual(4, (int)String(", , , ").Split(*pattern).Length, L"Split", LINE_INFO());
+			Assert::AreEqual(4, (int)String(", , , ").Split(String(", ")).Length, L"Split", LINE_INFO());
+			Assert::AreEqual(0, (int)String(", ").Split(*pattern, StringSplitOptions::RemoveEmptyEntries).Length, L"Split", LINE_INFO());
+
+			// replace
+			Assert::IsTrue(string.Replace(*pattern, ";").Compare("one;two;three;") == 0, L"Replace", LINE_INFO());
+			Assert::IsTrue(String("abAbaB").Replace(*insensitive, "-").Compare("---") == 0, L"Replace", LINE_INFO());
+		}
 
-			// TODO: add implementation when first sequence containers are finished
+		TEST_METHOD(StringIndexOfAnyTest)
+		{
+			// variables
+			String string("ABCdef, ABCdef");
+			Vector<char> sequence = { 'd', 'C' };
+
+			// (ISequence<char>)
+			Assert::AreEqual(2, string.IndexOfAny(sequence), L"(ISequence<char>)", LINE_INFO());
+			Assert::AreEqual(2, string.IndexOfAny(Vector<char>({ 'c', 'x' }), 0, CaseSensitivity::CaseInsensitive), L"(ISequence<char>) case insensitive", LINE_INFO());
+			Assert::AreEqual(10, string.LastIndexOfAny(sequence, 3), L"LastIndexOfAny(ISequence<char>)", LINE_INFO());
+
+			// (CharSet)
+			Assert::AreEqual(6, string.IndexOfAny(CharSet(", ")), L"(CharSet)", LINE_INFO());
+			Assert::AreEqual(7, string.IndexOfAny(CharSet(", "), 7), L"(CharSet, int)", LINE_INFO());
+			Assert::AreEqual(-1, string.IndexOfAny(CharSet("xyz")), L"(CharSet) no match", LINE_INFO());
+			Assert::AreEqual(7, string.LastIndexOfAny(CharSet(", ")), L"LastIndexOfAny(CharSet)", LINE_INFO());
+			Assert::AreEqual(-1, string.LastIndexOfAny(CharSet(", "), 8), L"LastIndexOfAny(CharSet, int)", LINE_INFO());
 		}
 
 		TEST_METHOD(StringLastIndexOfTest)
@@ -193,6 +393,8 @@ namespace FrameworkTest
 			// (String) case insensitive
 			Assert::AreEqual(4, string.LastIndexOf("aA", 0, CaseSensitivity::CaseInsensitive), L"(String) case sensitive", LINE_INFO());
 			Assert::AreEqual(0, string.LastIndexOf("aA", 3, CaseSensitivity::CaseInsensitive), L"(String, int) case sensitive", LINE_INFO());
+			Assert::AreEqual(36, String("one two one two one two one two one two").LastIndexOf("two"), L"(String) case sensitive", LINE_INFO());
+			Assert::AreEqual(-1, String("one two one two one two one two one two").LastIndexOf("three"), L"(String) case sensitive", LINE_INFO());
 
 			// (Char) cas sensitive
 			Assert::AreEqual(-1, string.LastIndexOf('C'), L"(Char) case sensitive -1", LINE_INFO());
@@ -228,6 +430,34 @@ namespace FrameworkTest
 			Assert::IsTrue(string.Replace("aacc", "bbee", CaseSensitivity::CaseInsensitive).Compare("bbeebbee") == 0, L"(String, String) case insensitive", LINE_INFO());
 		}
 
+		TEST_METHOD(StringReplaceAllTest)
+		{
+			// variables
+			String string("${user}@${host}:${user}");
+			Vector<String> before = { "${user}", "${host}" };
+			Vector<String> after = { "root", "localhost" };
+
+			// several patterns in a single pass
+			Assert::IsTrue(string.ReplaceAll(before, after).Compare("root@localhost:root") == 0, L"ReplaceAll", LINE_INFO());
+
+			// leftmost longest match, case insensitive
+			string = "ab abc xABCD";
+			Assert::IsTrue(string.ReplaceAll(Vector<String>({ "ab", "abcd", "bc" }), Vector<String>({ "1", "2", "3" }), CaseSensitivity::CaseInsensitive).Compare("1 1c x2") == 0, L"ReplaceAll", LINE_INFO());
+			Assert::IsTrue(string.ReplaceAll(Vector<String>({ "1", "x" }), Vector<String>({ "x", "1" })).Compare("x xc 12") == 0, L"ReplaceAll", LINE_INFO());
+			Assert::IsTrue(string.ReplaceAll(Vector<String>({ "" }), Vector<String>({ "y" })).Compare("x xc 12") == 0, L"ReplaceAll", LINE_INFO());
+
+			// growing and shrinking replacement
+			string = "abcabc";
+			Assert::IsTrue(string.Replace("b", "xyz").Compare("axyzcaxyzc") == 0, L"(String, String) growing", LINE_INFO());
+			Assert::IsTrue(string.Replace("xyz", "").Compare("acac") == 0, L"(String, String) shrinking", LINE_INFO());
+
+			// replacement containing the pattern
+			Assert::IsTrue(string.Replace("a", "aa").Compare("aacaac") == 0, L"(String, String) self containing", LINE_INFO());
+
+			// no match
+			Assert::IsTrue(string.Replace("z", "y").Compare("aacaac") == 0, L"(String, String) no match", LINE_INFO());
+		}
+
 		TEST_METHOD(StringSubstringTest)
 		{
 			// variables
@@ -238,6 +468,7 @@ namespace FrameworkTest
 
 			// (int, int) substring
 			Assert::IsTrue(string.Substring(2, 2).Compare("Cd") == 0, L"(int) substring", LINE_INFO());
+			Assert::IsTrue(string.Substring(2, 4).Compare("Cdef") == 0, L"(int) substring", LINE_INFO());
 		}
 
 		TEST_METHOD(StringToLowerTest)
@@ -247,6 +478,10 @@ namespace FrameworkTest
 
 			// test
 			Assert::IsTrue(string.ToLower().Compare("abcdef") == 0, L"to lower", LINE_INFO());
+
+			// whole blocks and utf-8 encoded latin-1 letters
+			string = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG @[`{ \xc3\x84\xc3\x96\xc3\x9c\xc3\x97 THE QUICK BROWN FOX";
+			Assert::IsTrue(string.ToLower() == "the quick brown fox jumps over the lazy dog @[`{ \xc3\xa4\xc3\xb6\xc3\xbc\xc3\x97 the quick brown fox", L"to lower", LINE_INFO());
 		}
 
 		TEST_METHOD(StringToUpperTest)
@@ -256,6 +491,40 @@ namespace FrameworkTest
 
 			// test
 			Assert::IsTrue(string.ToUpper().Compare("ABCDEF") == 0, L"to upper", LINE_INFO());
+
+			// whole blocks and utf-8 encoded latin-1 letters
+			string = "the quick brown fox jumps over the lazy dog @[`{ \xc3\xa4\xc3\xb6\xc3\xbc\xc3\xb7 the quick brown fox";
+			Assert::IsTrue(string.ToUpper() == "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG @[`{ \xc3\x84\xc3\x96\xc3\x9c\xc3\xb7 THE QUICK BROWN FOX", L"to upper", LINE_INFO());
+		}
+
+		TEST_METHOD(StringTransformTest)
+		{
+			// variables
+			String string("the quick brown fox jumps over the lazy dog, the quick brown fox");
+			ubyte table[256];
+			char bytes[256];
+
+			// replace separators
+			for (int i = 0; i < 256; i++) {
+				table[i] = static_cast<ubyte>((i == ' ' || i == ',') ? '_' : i);
+			}
+
+			Assert::IsTrue(string.Transform(table) == "the_quick_brown_fox_jumps_over_the_lazy_dog__the_quick_brown_fox", L"Transform", LINE_INFO());
+
+			// every byte value
+			for (int i = 0; i < 256; i++) {
+				bytes[i] = static_cast<char>((i + 1) & 0xff);
+				table[i] = static_cast<ubyte>(255 - i);
+			}
+
+			string = bytes;
+			string.Transform(table);
+
+			for (int i = 0; i < 255; i++) {
+				Assert::AreEqual(254 - i, (int)static_cast<ubyte>(string[i]), L"Transform", LINE_INFO());
+			}
+
+			Assert::ExpectException<ArgumentNullException>([&]() { string.Transform(nullptr); }, L"Transform", LINE_INFO());
 		}
 
 		TEST_METHOD(StringSplitTest)
@@ -337,6 +606,29 @@ namespace FrameworkTest
 			Assert::IsTrue(result[2] == "CDABCD");
 		}
 
+		TEST_METHOD(StringSplitCharSetTest)
+		{
+			// variables
+			String string("a, b;;c\td,");
+			Vector<String> result;
+
+			// empty entries
+			result = string.Split(CharSet(" \t,;"));
+			Assert::AreEqual(7, (int)result.Length, L"Split", LINE_INFO());
+			Assert::IsTrue(result[0] == "a" && result[1] == "" && result[2] == "b" && result[5] == "d" && result[6] == "", L"Split", LINE_INFO());
+
+			// no empty entries
+			result = string.Split(CharSet(" \t,;"), StringSplitOptions::RemoveEmptyEntries);
+			Assert::AreEqual(4, (int)result.Length, L"Split", LINE_INFO());
+			Assert::IsTrue(result[0] == "a" && result[1] == "b" && result[2] == "c" && result[3] == "d", L"Split", LINE_INFO());
+
+			// delimiters only
+			Assert::AreEqual(2, (int)String(",").Split(CharSet(",")).Length, L"Split", LINE_INFO());
+			Assert::AreEqual(4, (int)String(",,,").Split(CharSet(",")).Length, L"Split", LINE_INFO());
+			Assert::AreEqual(4, (int)String(",,,").Split(Vector<char>({ ',' })).Length, L"Split", LINE_INFO());
+			Assert::AreEqual(0, (int)String(",").Split(CharSet(","), StringSplitOptions::RemoveEmptyEntries).Length, L"Split", LINE_INFO());
+		}
+
 		TEST_METHOD(StringSplitNoEmptyTest)
 		{
 			// variables
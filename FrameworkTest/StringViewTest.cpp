@@ -0,0 +1,101 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "..\Framework\StringView.hpp"
+#include "..\Framework\String.hpp"
+#include "..\Framework\Exception.hpp"
+#include "..\Framework\TextSearch.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	TEST_CLASS(StringViewTest)
+	{
+		TEST_METHOD(StringViewConstructorTest)
+		{
+			// variables
+			const char* text = "ABCdef";
+			String string(text);
+
+			// construct
+			Assert::IsTrue(StringView().IsEmpty(), L"()", LINE_INFO());
+			Assert::AreEqual(6, StringView(text).Length(), L"(const char*)", LINE_INFO());
+			Assert::IsTrue(StringView(text, 3).Data() == text, L"(const char*, int)", LINE_INFO());
+			Assert::IsTrue(StringView(string).Data() == string.Data, L"(const String&)", LINE_INFO());
+			Assert::ExpectException<ArgumentNullException>([]() { StringView(nullptr); }, L"(nullptr)", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { StringView(text, -1); }, L"(const char*, -1)", LINE_INFO());
+
+			// materialize
+			Assert::IsTrue(String(StringView(text, 3)) == "ABC", L"String(const StringView&)", LINE_INFO());
+			Assert::IsTrue(StringView(text + 3).ToString() == "def", L"ToString", LINE_INFO());
+			Assert::IsTrue(StringView().ToString() == "", L"ToString", LINE_INFO());
+		}
+
+		TEST_METHOD(StringViewSubstringTest)
+		{
+			// variables
+			String string("ABCdef");
+			StringView view(string);
+
+			// slice without copying
+			Assert::IsTrue(view.Substring(2).Data() == string.Data + 2, L"Substring(int)", LINE_INFO());
+			Assert::IsTrue(view.Substring(2, 3) == "Cde", L"Substring(int, int)", LINE_INFO());
+			Assert::IsTrue(view.Substring(6).IsEmpty(), L"Substring(int)", LINE_INFO());
+			Assert::IsTrue(view.Substring(1, 4).Substring(1, 2) == "Cd", L"Substring(int, int)", LINE_INFO());
+			Assert::IsTrue(string.View(3) == "def", L"String::View(int)", LINE_INFO());
+			Assert::IsTrue(string.View(0, 6) == view, L"String::View(int, int)", LINE_INFO());
+			Assert::AreEqual('C', view[2], L"operator[]", LINE_INFO());
+
+			// out of range
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { view.Substring(7); }, L"Substring(7)", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { view.Substring(4, 3); }, L"Substring(4, 3)", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { view[6]; }, L"operator[]", LINE_INFO());
+		}
+
+		TEST_METHOD(StringViewSearchTest)
+		{
+			// variables
+			const char* text = "the quick brown fox jumps over the lazy dog";
+			StringView view(text);
+			BoyerMooreHorspool strategy;
+			String string(text);
+
+			// search within view
+			Assert::AreEqual(4, view.IndexOf("quick"), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(31, view.IndexOf("the", 1), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(-1, view.Substring(0, 8).IndexOf("quick"), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(4, view.IndexOf("QUICK", 0, CaseSensitivity::CaseInsensitive), L"IndexOf", LINE_INFO());
+			Assert::IsTrue(view.Contains(StringView("lazy dog", 4)), L"Contains", LINE_INFO());
+			Assert::IsTrue(view.Substring(4, 5).Compare("QUICK", CaseSensitivity::CaseInsensitive) == 0, L"Compare", LINE_INFO());
+
+			// search with views
+			Assert::AreEqual(16, strategy.Search(view, view.Substring(16, 3), CaseSensitivity::CaseSensitive), L"ITextSearchStrategy::Search", LINE_INFO());
+			Assert::AreEqual(10, String::Compile("brown")->Search(view), L"CompiledPattern::Search", LINE_INFO());
+
+			// string methods taking views
+			Assert::AreEqual(16, string.IndexOf(view.Substring(16, 3)), L"String::IndexOf", LINE_INFO());
+			Assert::IsTrue(string.Contains(view.Substring(35, 4)), L"String::Contains", LINE_INFO());
+			Assert::AreEqual(0, string.Compare(view, CaseSensitivity::CaseSensitive), L"String::Compare", LINE_INFO());
+			Assert::AreEqual(31, string.LastIndexOf(view.Substring(0, 3)), L"String::LastIndexOf", LINE_INFO());
+		}
+	};
+}
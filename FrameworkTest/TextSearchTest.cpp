@@ -0,0 +1,224 @@
+/* Copyright  2014 David Wolf <d.wolf@live.at>
+ *
+ * This file is part of LupusFramwork.
+ *
+ * LupusFramwork is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * LupusFramwork is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with LupusFramwork.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include <cstring>
+#include "..\Framework\CharSet.hpp"
+#include "..\Framework\String.hpp"
+#include "..\Framework\Simd.hpp"
+#include "..\Framework\TextSearch.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Lupus;
+using namespace Lupus::System;
+
+namespace FrameworkTest {
+	static void CheckStrategy(const ITextSearchStrategy* strategy, const wchar_t* message)
+	{
+		// variables
+		const char* text = "abaabaabbabaababbbabaabaaabababba";
+		int length = (int)strlen(text);
+
+		// compare against naive search
+		for (int start = 0; start < length; start++) {
+			for (int count = 1; start + count <= length; count++) {
+				const char* search = text + start;
+				int expected = -1;
+
+				for (int i = 0; i + count <= length; i++) {
+					if (strncmp(text + i, search, count) == 0) {
+						expected = i;
+						break;
+					}
+				}
+
+				Assert::AreEqual(expected, strategy->Search(text, length, search, count, CaseSensitivity::CaseSensitive), message, LINE_INFO());
+				Assert::AreEqual(expected, strategy->Compile(String(search, 0, count), CaseSensitivity::CaseSensitive)->Search(text, length), message, LINE_INFO());
+			}
+		}
+
+		// special cases
+		Assert::AreEqual(0, strategy->Search(text, length, "", 0, CaseSensitivity::CaseSensitive), message, LINE_INFO());
+		Assert::AreEqual(-1, strategy->Search("ab", 2, "abc", 3, CaseSensitivity::CaseSensitive), message, LINE_INFO());
+		Assert::AreEqual(-1, strategy->Search(text, length, "abc", 3, CaseSensitivity::CaseSensitive), message, LINE_INFO());
+		Assert::AreEqual(4, strategy->Search("the QUICK brown fox", 19, "quick brown", 11, CaseSensitivity::CaseInsensitive), message, LINE_INFO());
+		Assert::AreEqual(-1, strategy->Search("the QUICK brown fox", 19, "quick brown", 11, CaseSensitivity::CaseSensitive), message, LINE_INFO());
+		Assert::AreEqual(10, strategy->Search("AAAAAAAAAAaaab", 14, "AAAB", 4, CaseSensitivity::CaseInsensitive), message, LINE_INFO());
+		Assert::AreEqual(-1, strategy->Search("x\xc4y", 3, "X\xe4Y", 3, CaseSensitivity::CaseInsensitive), message, LINE_INFO());
+		Assert::AreEqual(4, strategy->Compile("quick brown", CaseSensitivity::CaseInsensitive)->Search("the QUICK brown fox", 19), message, LINE_INFO());
+		Assert::AreEqual(10, strategy->Compile("AAAB", CaseSensitivity::CaseInsensitive)->Search("AAAAAAAAAAaaab", 14), message, LINE_INFO());
+		Assert::AreEqual(0, strategy->Compile("", CaseSensitivity::CaseSensitive)->Search(text, length), message, LINE_INFO());
+	}
+
+	TEST_CLASS(TextSearchTest)
+	{
+		TEST_METHOD(TextSearchKnuthMorrisPrattTest)
+		{
+			KnuthMorrisPratt strategy;
+			CheckStrategy(&strategy, L"KnuthMorrisPratt");
+		}
+
+		TEST_METHOD(TextSearchBoyerMooreHorspoolTest)
+		{
+			BoyerMooreHorspool strategy;
+			CheckStrategy(&strategy, L"BoyerMooreHorspool");
+		}
+
+		TEST_METHOD(TextSearchTwoWayTest)
+		{
+			TwoWay strategy;
+			CheckStrategy(&strategy, L"TwoWay");
+		}
+
+		TEST_METHOD(TextSearchSimdSearchTest)
+		{
+			SimdSearch strategy;
+			CheckStrategy(&strategy, L"SimdSearch");
+		}
+
+		TEST_METHOD(TextSearchFindCharTest)
+		{
+			// variables
+			char text[301];
+
+			// match at every offset of a block
+			memset(text, '.', 300);
+			text[300] = 0;
+
+			for (int i = 0; i < 300; i++) {
+				text[i] = 'x';
+				Assert::AreEqual(i, FindChar(text, 300, 'x'), L"FindChar", LINE_INFO());
+				Assert::AreEqual(i, FindChar(text, 300, 'X', CaseSensitivity::CaseInsensitive), L"FindChar", LINE_INFO());
+				Assert::AreEqual(-1, FindChar(text, 300, 'X'), L"FindChar", LINE_INFO());
+				Assert::AreEqual(i, FindLastChar(text, 300, 'x'), L"FindLastChar", LINE_INFO());
+				Assert::AreEqual(i < 298 ? i : -1, FindString(text, 300, "x..", 3, CaseSensitivity::CaseInsensitive), L"FindString", LINE_INFO());
+				Assert::AreEqual(i < 2 ? -1 : i - 2, FindString(text, 300, "..x", 3), L"FindString", LINE_INFO());
+				Assert::AreEqual(i < 298 ? i : -1, FindLastString(text, 300, "x..", 3, CaseSensitivity::CaseInsensitive), L"FindLastString", LINE_INFO());
+				Assert::AreEqual(i < 2 ? -1 : i - 2, FindLastString(text, 300, "..X", 3, CaseSensitivity::CaseInsensitive), L"FindLastString", LINE_INFO());
+				text[i] = '.';
+			}
+
+			// first and last occurrence
+			text[17] = text[250] = 'y';
+			Assert::AreEqual(17, FindChar(text, 300, 'y'), L"FindChar", LINE_INFO());
+			Assert::AreEqual(250, FindLastChar(text, 300, 'y'), L"FindLastChar", LINE_INFO());
+			Assert::AreEqual(-1, FindChar(text, 17, 'y'), L"FindChar", LINE_INFO());
+			Assert::AreEqual(-1, FindLastChar(text, 17, 'y'), L"FindLastChar", LINE_INFO());
+			Assert::AreEqual(17, FindString(text, 300, "Y....", 5, CaseSensitivity::CaseInsensitive), L"FindString", LINE_INFO());
+			Assert::AreEqual(-1, FindString(text, 300, "Y....", 5), L"FindString", LINE_INFO());
+			Assert::AreEqual(250, FindLastString(text, 300, "y..", 3), L"FindLastString", LINE_INFO());
+			Assert::AreEqual(17, FindLastString(text, 250, "y..", 3), L"FindLastString", LINE_INFO());
+			Assert::AreEqual(-1, FindLastString(text, 17, "y", 1), L"FindLastString", LINE_INFO());
+		}
+
+		TEST_METHOD(TextSearchCountCharTest)
+		{
+			// variables
+			static char text[20001];
+
+			// every third char, enough blocks to flush the byte counters
+			for (int i = 0; i < 20000; i++) {
+				text[i] = (i % 3) ? '.' : ',';
+			}
+
+			text[20000] = 0;
+			Assert::AreEqual(6667, CountChar(text, 20000, ','), L"CountChar", LINE_INFO());
+			Assert::AreEqual(13333, CountChar(text, 20000, '.'), L"CountChar", LINE_INFO());
+			Assert::AreEqual(0, CountChar(text, 20000, ';'), L"CountChar", LINE_INFO());
+
+			for (int i = 0; i < 70; i++) {
+				Assert::AreEqual((i + 2) / 3, CountChar(text, i, ','), L"CountChar", LINE_INFO());
+				Assert::AreEqual(i / 3, CountChar(text + 1, i, ','), L"CountChar", LINE_INFO());
+			}
+		}
+
+		TEST_METHOD(TextSearchCompareCharsTest)
+		{
+			// variables
+			char lhs[101];
+			char rhs[101];
+
+			// mismatch at every offset of a block
+			for (int i = 0; i < 100; i++) {
+				lhs[i] = static_cast<char>('a' + i % 26);
+				rhs[i] = static_cast<char>('A' + i % 26);
+			}
+
+			lhs[100] = rhs[100] = 0;
+			Assert::AreEqual(0, CompareChars(lhs, rhs, 100, CaseSensitivity::CaseInsensitive), L"CompareChars", LINE_INFO());
+			Assert::IsTrue(CompareChars(lhs, rhs, 100) > 0, L"CompareChars", LINE_INFO());
+
+			for (int i = 0; i < 100; i++) {
+				char ch = rhs[i];
+				rhs[i] = '_';
+				Assert::IsTrue(CompareChars(lhs, rhs, 100, CaseSensitivity::CaseInsensitive) > 0, L"CompareChars", LINE_INFO());
+				Assert::IsTrue(CompareChars(rhs, lhs, 100, CaseSensitivity::CaseInsensitive) < 0, L"CompareChars", LINE_INFO());
+				Assert::AreEqual(0, CompareChars(lhs, rhs, i, CaseSensitivity::CaseInsensitive), L"CompareChars", LINE_INFO());
+				rhs[i] = ch;
+			}
+
+			// only ascii letters are folded
+			Assert::AreEqual(0, CompareChars("@[`{", "@[`{", 4, CaseSensitivity::CaseInsensitive), L"CompareChars", LINE_INFO());
+			Assert::IsTrue(CompareChars("@", "`", 1, CaseSensitivity::CaseInsensitive) != 0, L"CompareChars", LINE_INFO());
+			Assert::IsTrue(CompareChars("\xc4", "\xe4", 1, CaseSensitivity::CaseInsensitive) < 0, L"CompareChars", LINE_INFO());
+			Assert::IsTrue(CompareChars("\xff", "a", 1) > 0, L"CompareChars", LINE_INFO());
+			Assert::AreEqual(0, CompareCharsLocale("ABC", "abc", 3), L"CompareCharsLocale", LINE_INFO());
+		}
+
+		TEST_METHOD(TextSearchAsciiFoldTest)
+		{
+			// search, compare and char sets fold the same chars regardless of the locale
+			for (int i = 0; i < 256; i++) {
+				char lhs[3] = { 'x', static_cast<char>(i), 'y' };
+				CharSet set = CharSet().Add(lhs[1]).FoldCase();
+
+				for (int j = 0; j < 256; j++) {
+					char rhs[3] = { 'X', static_cast<char>(j), 'Y' };
+					bool equal = (AsciiLowerTable[i] == AsciiLowerTable[j]);
+
+					Assert::AreEqual(equal, CompareChars(lhs, rhs, 3, CaseSensitivity::CaseInsensitive) == 0, L"CompareChars", LINE_INFO());
+					Assert::AreEqual(equal, FindChar(rhs + 1, 1, lhs[1], CaseSensitivity::CaseInsensitive) == 0, L"FindChar", LINE_INFO());
+					Assert::AreEqual(equal, FindString(rhs, 3, lhs, 3, CaseSensitivity::CaseInsensitive) == 0, L"FindString", LINE_INFO());
+					Assert::AreEqual(equal, set.Contains(rhs[1]), L"FoldCase", LINE_INFO());
+				}
+			}
+
+			Assert::AreEqual(static_cast<int>('a'), static_cast<int>(AsciiLowerTable['A']), L"AsciiLowerTable", LINE_INFO());
+			Assert::AreEqual(static_cast<int>('Z'), static_cast<int>(AsciiUpperTable['z']), L"AsciiUpperTable", LINE_INFO());
+			Assert::AreEqual(0xc4, static_cast<int>(AsciiLowerTable[0xc4]), L"AsciiLowerTable", LINE_INFO());
+		}
+
+		TEST_METHOD(TextSearchAdaptiveSearchTest)
+		{
+			// variables
+			AdaptiveSearch strategy;
+			String string("Hello World, hello world!");
+
+			// strategy
+			CheckStrategy(&strategy, L"AdaptiveSearch");
+
+			// used by string
+			string.TextSearchAlgorithm = &strategy;
+			Assert::AreEqual(13, string.IndexOf("hello"), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(6, string.IndexOf("WORLD", 0, CaseSensitivity::CaseInsensitive), L"IndexOf", LINE_INFO());
+			Assert::AreEqual(19, string.IndexOf("WORLD", 7, CaseSensitivity::CaseInsensitive), L"IndexOf", LINE_INFO());
+			Assert::IsTrue(string.Contains("world!"), L"Contains", LINE_INFO());
+		}
+	};
+}
@@ -21,12 +21,33 @@
 #include "..\Framework\String.hpp"
 #include "..\Framework\Exception.hpp"
 #include "..\Framework\Vector.hpp"
+#include <limits>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Lupus;
 using namespace Lupus::System;
 
 namespace FrameworkTest {
+	//! counts living instances and copies
+	struct Tracked
+	{
+		static int Instances;
+		static int Copies;
+		int value;
+
+		Tracked() : value(0) { Instances++; }
+		Tracked(int v) : value(v) { Instances++; }
+		Tracked(const Tracked& other) : value(other.value) { Instances++; Copies++; }
+		Tracked(Tracked&& other) : value(other.value) { other.value = -1; Instances++; }
+		~Tracked() { Instances--; }
+		Tracked& operator=(const Tracked& other) { value = other.value; Copies++; return *this; }
+		Tracked& operator=(Tracked&& other) { value = other.value; other.value = -1; return *this; }
+		bool operator==(const Tracked& other) const { return (value == other.value); }
+	};
+
+	int Tracked::Instances = 0;
+	int Tracked::Copies = 0;
+
 	TEST_CLASS(VectorTest)
 	{
 		TEST_METHOD(VectorConstructorTest)
@@ -81,6 +102,71 @@ namespace FrameworkTest {
 			Assert::AreEqual(3, vec[2], L"", LINE_INFO());
 		}
 
+		TEST_METHOD(VectorGrowthTest)
+		{
+			// variables
+			Vector<int> vec;
+			Vector<int> empty;
+			int reallocations = 0;
+
+			// capacity grows geometrically, so adding stays amortized constant
+			for (int i = 0; i < 1000000; i++) {
+				int capacity = vec.Capacity;
+				vec.Add(i);
+				reallocations += (capacity != (int)vec.Capacity);
+			}
+
+			Assert::AreEqual(1000000, (int)vec.Length, L"Add", LINE_INFO());
+			Assert::IsTrue(reallocations < 40, L"Add", LINE_INFO());
+
+			for (int i = 0; i < 1000000; i += 999) {
+				Assert::AreEqual(i, vec[i], L"Add", LINE_INFO());
+			}
+
+			// adding an item of the vector itself
+			vec.ShrinkToFit();
+			vec.Add(vec[0]);
+			vec.Insert(0, vec[1000000]);
+			Assert::AreEqual(0, vec[1000001], L"Add", LINE_INFO());
+			Assert::AreEqual(0, vec[0], L"Insert", LINE_INFO());
+
+			// reserve is exact and keeps the items
+			empty.Reserve(100);
+			Assert::AreEqual(100, (int)empty.Capacity, L"Reserve", LINE_INFO());
+			Assert::AreEqual(0, (int)empty.Length, L"Reserve", LINE_INFO());
+			empty.Reserve(10);
+			Assert::AreEqual(100, (int)empty.Capacity, L"Reserve", LINE_INFO());
+
+			// growth factor
+			empty.SetGrowthFactor(2.0f);
+			empty.Resize(100);
+			empty.Add(1);
+			Assert::AreEqual(200, (int)empty.Capacity, L"GrowthFactor", LINE_INFO());
+			Assert::AreEqual(2.0f, (float)Vector<int>(empty).GrowthFactor, L"GrowthFactor", LINE_INFO());
+			Assert::AreEqual(0, (int)Vector<int>(Vector<int>()).Length, L"Vector(copy)", LINE_INFO());
+
+			// assignment carries the growth factor like construction
+			vec = empty;
+			Assert::AreEqual(2.0f, (float)vec.GrowthFactor, L"operator=", LINE_INFO());
+			vec.SetGrowthFactor(3.0f);
+			empty = std::move(vec);
+			Assert::AreEqual(3.0f, (float)empty.GrowthFactor, L"operator=(move)", LINE_INFO());
+
+			// factors that don't grow are rejected
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { empty.SetGrowthFactor(1.0f); }, L"GrowthFactor", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { empty.SetGrowthFactor(std::numeric_limits<float>::quiet_NaN()); }, L"GrowthFactor", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([&]() { empty.SetGrowthFactor(std::numeric_limits<float>::infinity()); }, L"GrowthFactor", LINE_INFO());
+			Assert::ExpectException<ArgumentOutOfRangeException>([]() { Vector<int>::SetDefaultGrowthFactor(-2.0f); }, L"DefaultGrowthFactor", LINE_INFO());
+			Assert::AreEqual(3.0f, (float)empty.GrowthFactor, L"GrowthFactor", LINE_INFO());
+			Assert::AreEqual(1.5f, (float)Vector<int>::DefaultGrowthFactor, L"DefaultGrowthFactor", LINE_INFO());
+
+			// a single item capacity still grows
+			Vector<int> single({ 1 });
+			single.SetGrowthFactor(1.1f);
+			single.Add(2);
+			Assert::AreEqual(2, (int)single.Capacity, L"GrowthFactor", LINE_INFO());
+		}
+
 		TEST_METHOD(VectorFrontBackTest)
 		{
 			// variables
@@ -118,6 +204,8 @@ namespace FrameworkTest {
 			Assert::IsTrue(vec.Contains(2), L"", LINE_INFO());
 			Assert::IsTrue(vec.Contains(3), L"", LINE_INFO());
 			Assert::IsFalse(vec.Contains(4), L"", LINE_INFO());
+			Assert::IsTrue(Vector<char>({ 'a', 'b', 'c' }).Contains('c'), L"", LINE_INFO());
+			Assert::IsFalse(Vector<char>({ 'a', 'b', 'c' }).Contains('d'), L"", LINE_INFO());
 		}
 
 		TEST_METHOD(VectorCopyToTest)
@@ -196,10 +284,19 @@ namespace FrameworkTest {
 			Assert::AreEqual(4, (int)vec.Length, L"", LINE_INFO());
 			Assert::AreEqual(8, (int)vec.Capacity, L"", LINE_INFO());
 
+			// resize within capacity
+			vec[0] = 5;
+			vec.Resize(6);
+			Assert::AreEqual(6, (int)vec.Length, L"", LINE_INFO());
+			Assert::AreEqual(8, (int)vec.Capacity, L"", LINE_INFO());
+			Assert::AreEqual(0, vec[5], L"", LINE_INFO());
+
 			// resize
 			vec.Resize(16);
 			Assert::AreEqual(16, (int)vec.Length, L"", LINE_INFO());
 			Assert::AreEqual(16, (int)vec.Capacity, L"", LINE_INFO());
+			Assert::AreEqual(5, vec[0], L"", LINE_INFO());
+			Assert::AreEqual(0, vec[15], L"", LINE_INFO());
 		}
 
 		TEST_METHOD(VectorShrinkTest)
@@ -243,5 +340,64 @@ namespace FrameworkTest {
 			Assert::AreEqual(2, move[1], L"", LINE_INFO());
 			Assert::AreEqual(3, move[2], L"", LINE_INFO());
 		}
+
+		TEST_METHOD(VectorMoveTest)
+		{
+			// variables
+			Tracked::Instances = Tracked::Copies = 0;
+
+			{
+				Vector<Tracked> vec;
+				Tracked item(7);
+
+				// spare capacity holds no items
+				Assert::AreEqual(1, Tracked::Instances, L"Vector()", LINE_INFO());
+
+				// growth moves items instead of copying them
+				for (int i = 0; i < 100; i++) {
+					vec.EmplaceBack(i);
+				}
+
+				vec.Add(Tracked(100));
+				Assert::AreEqual(0, Tracked::Copies, L"EmplaceBack", LINE_INFO());
+				Assert::AreEqual(102, Tracked::Instances, L"EmplaceBack", LINE_INFO());
+				Assert::AreEqual(100, vec[100].value, L"Add", LINE_INFO());
+
+				// copies only where asked for
+				vec.Add(item);
+				vec.Insert(0, item);
+				Assert::AreEqual(2, Tracked::Copies, L"Add", LINE_INFO());
+				Assert::AreEqual(7, vec[0].value, L"Insert", LINE_INFO());
+				Assert::AreEqual(0, vec[1].value, L"Insert", LINE_INFO());
+				Assert::AreEqual(7, vec[102].value, L"Add", LINE_INFO());
+
+				// items of the vector itself survive the reallocation
+				vec.ShrinkToFit();
+				vec.EmplaceBack(vec[1]);
+				Assert::AreEqual(0, vec[103].value, L"EmplaceBack", LINE_INFO());
+
+				// removed items are destroyed
+				vec.RemoveAt(0);
+				Assert::AreEqual(0, vec[0].value, L"RemoveAt", LINE_INFO());
+				vec.Resize(50);
+				Assert::AreEqual(51, Tracked::Instances, L"Resize", LINE_INFO());
+				vec.Clear();
+				Assert::AreEqual(1, Tracked::Instances, L"Clear", LINE_INFO());
+
+				// swap moves
+				Tracked first(1), second(2);
+				int copies = Tracked::Copies;
+				Lupus::Swap(first, second);
+				Assert::IsTrue(first.value == 2 && second.value == 1, L"Swap", LINE_INFO());
+				Assert::AreEqual(copies, (int)Tracked::Copies, L"Swap", LINE_INFO());
+
+				// moved vectors keep working
+				Vector<Tracked> moved(std::move(vec));
+				vec.Add(item);
+				Assert::AreEqual(1, (int)vec.Length, L"Vector(move)", LINE_INFO());
+			}
+
+			Assert::AreEqual(0, Tracked::Instances, L"~Vector", LINE_INFO());
+		}
 	};
 }